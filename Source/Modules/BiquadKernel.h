@@ -0,0 +1,571 @@
+/*
+  ==============================================================================
+
+    BiquadKernel.h
+    Created: 17 Oct 2026 7:15:00am
+    Author:  StoneyDSP
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#ifndef BIQUADKERNEL_H_INCLUDED
+#define BIQUADKERNEL_H_INCLUDED
+
+#include "../JuceLibraryCode/JuceHeader.h"
+#include "BiquadState.h"
+
+/**
+    Relations between the coefficients that a kernel may rely on, so that it
+    can skip the multiplies they make redundant. With the coefficients
+    ordered { b0, b1, b2, a1, a2 }:
+
+        general     none; five multiplies per sample
+        firstOrder  b2 = a2 = 0; three
+        notch       b2 = b0 and b1 = -a1; three, four in DFIIt
+        allPass     b0 = -a2, b1 = -a1 and b2 = 1; two in DFI, three in
+                    DFII and DFIt, four in DFIIt
+
+    A single channel runs at the speed of its feedback path, not its
+    multiply count, so no kernel lengthens that path to save a multiply;
+    where sharing a product would, as in DFIIt, it is not shared. The
+    first-order DFI kernel also shortens the path, by one add.
+
+    The relations must hold exactly, except b2 = 1, which the all-pass
+    kernel assumes instead of reading; the first-order kernel gives the same
+    result bit for bit as the general one, the notch and all-pass kernels
+    the same to rounding.
+
+    On x86-64 at -O3 the saving is a few percent at most: the notch and
+    all-pass kernels run 0-7% faster in DFII and DFIt, and within 2% of the
+    general kernel elsewhere, singly or in lanes. What they save is
+    multiplier ports, which matters more on narrower cores.
+*/
+enum class KernelStructure
+{
+    general = 0,
+    firstOrder = 1,
+    notch = 2,
+    allPass = 3
+};
+
+/**
+    The biquad recursion, shared by every filter in the project.
+
+    Each transform is its own specialisation, so the topology is fixed at
+    compile time and the compiler sees one straight-line recursion. The
+    kernel owns no state: it runs blocks or single samples through the
+    delay elements of a BiquadState, with the coefficients ordered
+    { b0, b1, b2, a1, a2 } and the feedback terms already negated.
+
+    process() works through a block channel by channel, or, if asked,
+    SIMDType::size() channels at a time in parallel lanes. Given a ramp, it
+    advances every coefficient by its delta before each sample. Use
+    withBiquadKernel() to pick the specialisation for a transform chosen at
+    run time.
+
+    A Structure other than general swaps in a reduced recursion for
+    coefficients with known relations; see KernelStructure. The delay
+    elements keep the same layout, but the first-order kernel leaves those
+    it does not need untouched, so reset the state on a change of structure.
+*/
+template <typename SampleType, TransformationType Type, KernelStructure Structure = KernelStructure::general>
+struct BiquadKernel
+{
+    using SIMDType = juce::dsp::SIMDRegister<SampleType>;
+
+    static constexpr TransformationType type = Type;
+    static constexpr KernelStructure structure = Structure;
+    static constexpr size_t numStates = BiquadState<SampleType>::getNumStates(Type);
+
+    //==============================================================================
+    /** Runs every channel of a block. When Ramp is set, each coefficient is
+        advanced by its delta before every sample; otherwise the deltas are
+        ignored. Vectorised groups channels into SIMD lanes, a register at a
+        time; a last group of two or more that does not fill a register,
+        e.g. stereo, runs in the lower lanes of a zero-padded one, and a
+        lone channel left over runs on its own.
+    */
+    template <bool Ramp, typename InputBlock, typename OutputBlock>
+    static void process(BiquadState<SampleType>& state, const InputBlock& inputBlock, OutputBlock& outputBlock,
+                        const SampleType (&initialCoeffs)[5], const SampleType (&deltaCoeffs)[5], bool vectorised) noexcept
+    {
+        const auto numChannels = outputBlock.getNumChannels();
+        const auto numSamples = outputBlock.getNumSamples();
+
+        size_t channel = 0;
+
+        if (vectorised)
+        {
+            for (; channel + 1 < numChannels; channel += SIMDType::size())
+            {
+                const auto numActive = juce::jmin(SIMDType::size(), numChannels - channel);
+                processLanes<Ramp>(state, channel, numActive, inputBlock, outputBlock, initialCoeffs, deltaCoeffs);
+            }
+
+            channel = juce::jmin(channel, numChannels);
+        }
+
+        for (; channel < numChannels; ++channel)
+        {
+            auto* inputSamples = inputBlock.getChannelPointer(channel);
+            auto* outputSamples = outputBlock.getChannelPointer(channel);
+
+            SampleType s[4] = {};
+            loadState(state, channel, s);
+
+            SampleType c[5] = { initialCoeffs[0], initialCoeffs[1], initialCoeffs[2], initialCoeffs[3], initialCoeffs[4] };
+
+            for (size_t i = 0; i < numSamples; ++i)
+            {
+                if constexpr (Ramp)
+                    for (size_t k = 0; k < 5; ++k)
+                        c[k] += deltaCoeffs[k];
+
+                outputSamples[i] = tick(inputSamples[i], s, c);
+            }
+
+            storeState(state, channel, s);
+        }
+    }
+
+    /** Runs every channel of a block with fixed coefficients. */
+    template <typename InputBlock, typename OutputBlock>
+    static void process(BiquadState<SampleType>& state, const InputBlock& inputBlock, OutputBlock& outputBlock,
+                        const SampleType (&coeffs)[5], bool vectorised) noexcept
+    {
+        process<false>(state, inputBlock, outputBlock, coeffs, coeffs, vectorised);
+    }
+
+    /** Runs one sample of one channel. */
+    static SampleType processSample(BiquadState<SampleType>& state, size_t channel, SampleType inputValue, const SampleType (&coeffs)[5]) noexcept
+    {
+        SampleType s[4] = {};
+        loadState(state, channel, s);
+
+        const auto outputValue = tick(inputValue, s, coeffs);
+
+        storeState(state, channel, s);
+        return outputValue;
+    }
+
+    /** Returns true if a coefficient set passes its input through as it is,
+        i.e. { 1, 0, 0, 0, 0 } up to the signs of the zeros, as a flat peak
+        designs. */
+    static bool isIdentity(const SampleType (&coeffs)[5]) noexcept
+    {
+        return coeffs[0] == SampleType(1.0) && coeffs[1] == SampleType(0.0) && coeffs[2] == SampleType(0.0)
+            && coeffs[3] == SampleType(0.0) && coeffs[4] == SampleType(0.0);
+    }
+
+    /** Runs every channel of a block with coefficients for which
+        isIdentity() holds, at the cost of a copy, or nothing in place.
+
+        Under the identity every form outputs its input, once two samples
+        have flushed whatever the delay elements held, and after two samples
+        the delay elements depend on nothing but those inputs. So only the
+        first and last identityEdge samples go through tick(); the output
+        and the state are exactly those of running the whole block, and the
+        filter can leave or re-enter the identity at any sample without a
+        click and without a crossfade.
+    */
+    template <typename InputBlock, typename OutputBlock>
+    static void processIdentity(BiquadState<SampleType>& state, const InputBlock& inputBlock, OutputBlock& outputBlock,
+                                const SampleType (&coeffs)[5]) noexcept
+    {
+        jassert(isIdentity(coeffs));
+
+        const auto numSamples = outputBlock.getNumSamples();
+
+        if (numSamples <= 2 * identityEdge)
+        {
+            process(state, inputBlock, outputBlock, coeffs, false);
+            return;
+        }
+
+        for (size_t channel = 0; channel < outputBlock.getNumChannels(); ++channel)
+        {
+            auto* inputSamples = inputBlock.getChannelPointer(channel);
+            auto* outputSamples = outputBlock.getChannelPointer(channel);
+
+            SampleType s[4] = {};
+            loadState(state, channel, s);
+
+            for (size_t i = 0; i < identityEdge; ++i)
+                outputSamples[i] = tick(inputSamples[i], s, coeffs);
+
+            if (outputSamples != inputSamples)
+                std::copy(inputSamples + identityEdge, inputSamples + (numSamples - identityEdge), outputSamples + identityEdge);
+
+            for (size_t i = numSamples - identityEdge; i < numSamples; ++i)
+                outputSamples[i] = tick(inputSamples[i], s, coeffs);
+
+            storeState(state, channel, s);
+        }
+    }
+
+    /** The samples at each end of a block that processIdentity() filters. */
+    static constexpr size_t identityEdge = 2;
+
+    //==============================================================================
+    /** One step of the topology, on a SampleType or a SIMDType. The state
+        array holds only the delay elements that the form actually uses, see
+        loadState() for the layout.
+    */
+    template <typename ValueType>
+    static forcedinline ValueType tick(ValueType Xn, ValueType (&s)[4], const ValueType (&c)[5]) noexcept
+    {
+        if constexpr (Structure == KernelStructure::firstOrder)
+            return tickFirstOrder(Xn, s, c);
+        else if constexpr (Structure == KernelStructure::notch)
+            return tickNotch(Xn, s, c);
+        else if constexpr (Structure == KernelStructure::allPass)
+            return tickAllPass(Xn, s, c);
+        else if constexpr (Type == TransformationType::directFormI)
+        {
+            const ValueType Yn = ((Xn * c[0]) + (s[0] * c[1]) + (s[1] * c[2]) + (s[2] * c[3]) + (s[3] * c[4]));
+
+            s[1] = s[0];
+            s[3] = s[2];
+            s[0] = Xn;
+            s[2] = Yn;
+
+            return Yn;
+        }
+        else if constexpr (Type == TransformationType::directFormII)
+        {
+            const ValueType Wn = (Xn + ((s[0] * c[3]) + (s[1] * c[4])));
+            const ValueType Yn = ((Wn * c[0]) + (s[0] * c[1]) + (s[1] * c[2]));
+
+            s[1] = s[0];
+            s[0] = Wn;
+
+            return Yn;
+        }
+        else if constexpr (Type == TransformationType::directFormItransposed)
+        {
+            const ValueType Wn = (Xn + s[1]);
+            const ValueType Yn = ((Wn * c[0]) + s[3]);
+
+            s[3] = ((Wn * c[1]) + s[2]);
+            s[1] = ((Wn * c[3]) + s[0]);
+            s[2] = (Wn * c[2]);
+            s[0] = (Wn * c[4]);
+
+            return Yn;
+        }
+        else
+        {
+            const ValueType Yn = ((Xn * c[0]) + (s[1]));
+
+            s[1] = ((Xn * c[1]) + (s[0]) + (Yn * c[3]));
+            s[0] = ((Xn * c[2]) + (Yn * c[4]));
+
+            return Yn;
+        }
+    }
+
+    /** Copies the live delay elements of one channel into s[], laid out as
+        documented in BiquadState.
+    */
+    static void loadState(const BiquadState<SampleType>& state, size_t channel, SampleType (&s)[4]) noexcept
+    {
+        jassert(state.getNumStates() == numStates);
+
+        const auto* channelState = state.getChannelPointer(channel);
+
+        for (size_t k = 0; k < numStates; ++k)
+            s[k] = channelState[k];
+    }
+
+    /** Writes s[] back to the state, see loadState(). */
+    static void storeState(BiquadState<SampleType>& state, size_t channel, const SampleType (&s)[4]) noexcept
+    {
+        jassert(state.getNumStates() == numStates);
+
+        auto* channelState = state.getChannelPointer(channel);
+
+        for (size_t k = 0; k < numStates; ++k)
+            channelState[k] = s[k];
+    }
+
+private:
+    //==============================================================================
+    /** tick() for b2 = a2 = 0. The delay elements that would only ever hold
+        zero are left alone. */
+    template <typename ValueType>
+    static forcedinline ValueType tickFirstOrder(ValueType Xn, ValueType (&s)[4], const ValueType (&c)[5]) noexcept
+    {
+        if constexpr (Type == TransformationType::directFormI)
+        {
+            const ValueType Yn = ((Xn * c[0]) + (s[0] * c[1]) + (s[2] * c[3]));
+
+            s[0] = Xn;
+            s[2] = Yn;
+
+            return Yn;
+        }
+        else if constexpr (Type == TransformationType::directFormII)
+        {
+            const ValueType Wn = (Xn + (s[0] * c[3]));
+            const ValueType Yn = ((Wn * c[0]) + (s[0] * c[1]));
+
+            s[0] = Wn;
+
+            return Yn;
+        }
+        else if constexpr (Type == TransformationType::directFormItransposed)
+        {
+            const ValueType Wn = (Xn + s[1]);
+            const ValueType Yn = ((Wn * c[0]) + s[3]);
+
+            s[3] = (Wn * c[1]);
+            s[1] = (Wn * c[3]);
+
+            return Yn;
+        }
+        else
+        {
+            const ValueType Yn = ((Xn * c[0]) + (s[1]));
+
+            s[1] = ((Xn * c[1]) + (Yn * c[3]));
+
+            return Yn;
+        }
+    }
+
+    /** tick() for b2 = b0 and b1 = -a1: the zeros share one gain, and the
+        zero and pole at the same angle share one product. */
+    template <typename ValueType>
+    static forcedinline ValueType tickNotch(ValueType Xn, ValueType (&s)[4], const ValueType (&c)[5]) noexcept
+    {
+        if constexpr (Type == TransformationType::directFormI)
+        {
+            const ValueType Yn = ((((Xn + s[1]) * c[0]) + (s[3] * c[4])) + ((s[2] - s[0]) * c[3]));
+
+            s[1] = s[0];
+            s[3] = s[2];
+            s[0] = Xn;
+            s[2] = Yn;
+
+            return Yn;
+        }
+        else if constexpr (Type == TransformationType::directFormII)
+        {
+            const ValueType feedback = (s[0] * c[3]);
+            const ValueType Wn = (Xn + (feedback + (s[1] * c[4])));
+            const ValueType Yn = (((Wn + s[1]) * c[0]) - feedback);
+
+            s[1] = s[0];
+            s[0] = Wn;
+
+            return Yn;
+        }
+        else if constexpr (Type == TransformationType::directFormItransposed)
+        {
+            const ValueType Wn = (Xn + s[1]);
+            const ValueType zero = (Wn * c[0]);
+            const ValueType pole = (Wn * c[3]);
+            const ValueType Yn = (zero + s[3]);
+
+            s[3] = (s[2] - pole);
+            s[1] = (pole + s[0]);
+            s[2] = zero;
+            s[0] = (Wn * c[4]);
+
+            return Yn;
+        }
+        else
+        {
+            const ValueType zero = (Xn * c[0]);
+            const ValueType Yn = (zero + (s[1]));
+
+            s[1] = ((Xn * c[1]) + (s[0]) + (Yn * c[3]));
+            s[0] = (zero + (Yn * c[4]));
+
+            return Yn;
+        }
+    }
+
+    /** tick() for b0 = -a2, b1 = -a1 and b2 = 1: the numerator mirrors the
+        denominator, so each pole shares its product with a zero. */
+    template <typename ValueType>
+    static forcedinline ValueType tickAllPass(ValueType Xn, ValueType (&s)[4], const ValueType (&c)[5]) noexcept
+    {
+        if constexpr (Type == TransformationType::directFormI)
+        {
+            const ValueType Yn = ((((Xn - s[3]) * c[0]) + s[1]) + ((s[0] - s[2]) * c[1]));
+
+            s[1] = s[0];
+            s[3] = s[2];
+            s[0] = Xn;
+            s[2] = Yn;
+
+            return Yn;
+        }
+        else if constexpr (Type == TransformationType::directFormII)
+        {
+            const ValueType feedback = (s[0] * c[3]);
+            const ValueType Wn = (Xn + (feedback + (s[1] * c[4])));
+            const ValueType Yn = (((Wn * c[0]) - feedback) + s[1]);
+
+            s[1] = s[0];
+            s[0] = Wn;
+
+            return Yn;
+        }
+        else if constexpr (Type == TransformationType::directFormItransposed)
+        {
+            const ValueType Wn = (Xn + s[1]);
+            const ValueType pole = (Wn * c[3]);
+            const ValueType Yn = ((Wn * c[0]) + s[3]);
+
+            s[3] = (s[2] - pole);
+            s[1] = (pole + s[0]);
+            s[2] = Wn;
+            s[0] = (Wn * c[4]);
+
+            return Yn;
+        }
+        else
+        {
+            const ValueType Yn = ((Xn * c[0]) + (s[1]));
+
+            s[1] = ((Xn * c[1]) + (s[0]) + (Yn * c[3]));
+            s[0] = (Xn - (Yn * c[0]));
+
+            return Yn;
+        }
+    }
+
+    //==============================================================================
+    /** Runs numActive adjacent channels at once, one channel per lane, up to
+        SIMDType::size(). Audio is interleaved into an aligned scratch buffer
+        a chunk at a time so the recursion itself only touches registers.
+        Unused lanes run on zeros, which they keep, and are never stored.
+    */
+    template <bool Ramp, typename InputBlock, typename OutputBlock>
+    static void processLanes(BiquadState<SampleType>& state, size_t firstChannel, size_t numActive, const InputBlock& inputBlock, OutputBlock& outputBlock,
+                             const SampleType (&initialCoeffs)[5], const SampleType (&deltaCoeffs)[5]) noexcept
+    {
+        constexpr auto numLanes = SIMDType::size();
+        constexpr size_t chunkSize = 32;
+
+        jassert(0 < numActive && numActive <= numLanes);
+
+        const auto numSamples = outputBlock.getNumSamples();
+
+        alignas (SIMDType::SIMDRegisterSize) SampleType laneState[4][numLanes] = {};
+        alignas (SIMDType::SIMDRegisterSize) SampleType scratch[chunkSize * numLanes];
+
+        if (numActive < numLanes)
+            std::fill(scratch, scratch + (chunkSize * numLanes), SampleType(0.0));
+
+        for (size_t lane = 0; lane < numActive; ++lane)
+        {
+            SampleType s[4] = {};
+            loadState(state, firstChannel + lane, s);
+
+            for (size_t k = 0; k < 4; ++k)
+                laneState[k][lane] = s[k];
+        }
+
+        SIMDType s[4], c[5], d[5];
+
+        for (size_t k = 0; k < 4; ++k)
+            s[k] = SIMDType::fromRawArray(laneState[k]);
+
+        for (size_t k = 0; k < 5; ++k)
+        {
+            c[k] = SIMDType::expand(initialCoeffs[k]);
+            d[k] = SIMDType::expand(deltaCoeffs[k]);
+        }
+
+        for (size_t start = 0; start < numSamples; start += chunkSize)
+        {
+            const auto num = juce::jmin(chunkSize, numSamples - start);
+
+            for (size_t lane = 0; lane < numActive; ++lane)
+            {
+                auto* inputSamples = inputBlock.getChannelPointer(firstChannel + lane) + start;
+
+                for (size_t i = 0; i < num; ++i)
+                    scratch[i * numLanes + lane] = inputSamples[i];
+            }
+
+            for (size_t i = 0; i < num; ++i)
+            {
+                if constexpr (Ramp)
+                    for (size_t k = 0; k < 5; ++k)
+                        c[k] += d[k];
+
+                auto* frame = scratch + i * numLanes;
+                tick(SIMDType::fromRawArray(frame), s, c).copyToRawArray(frame);
+            }
+
+            for (size_t lane = 0; lane < numActive; ++lane)
+            {
+                auto* outputSamples = outputBlock.getChannelPointer(firstChannel + lane) + start;
+
+                for (size_t i = 0; i < num; ++i)
+                    outputSamples[i] = scratch[i * numLanes + lane];
+            }
+        }
+
+        for (size_t k = 0; k < 4; ++k)
+            s[k].copyToRawArray(laneState[k]);
+
+        for (size_t lane = 0; lane < numActive; ++lane)
+        {
+            SampleType channelState[4];
+
+            for (size_t k = 0; k < 4; ++k)
+                channelState[k] = laneState[k][lane];
+
+            storeState(state, firstChannel + lane, channelState);
+        }
+    }
+};
+
+//==============================================================================
+/** Calls function with a default-constructed BiquadKernel for the given
+    transform, and returns its result. Unknown transforms fall back to
+    direct form II transposed.
+*/
+template <typename SampleType, KernelStructure Structure = KernelStructure::general, typename Function>
+forcedinline decltype(auto) withBiquadKernel(TransformationType type, Function&& function)
+{
+    switch (type)
+    {
+    case TransformationType::directFormI:
+        return function(BiquadKernel<SampleType, TransformationType::directFormI, Structure>{});
+    case TransformationType::directFormII:
+        return function(BiquadKernel<SampleType, TransformationType::directFormII, Structure>{});
+    case TransformationType::directFormItransposed:
+        return function(BiquadKernel<SampleType, TransformationType::directFormItransposed, Structure>{});
+    case TransformationType::directFormIItransposed:
+    default:
+        return function(BiquadKernel<SampleType, TransformationType::directFormIItransposed, Structure>{});
+    }
+}
+
+/** As above, also choosing the kernel's structure at run time. */
+template <typename SampleType, typename Function>
+forcedinline decltype(auto) withBiquadKernel(TransformationType type, KernelStructure structure, Function&& function)
+{
+    switch (structure)
+    {
+    case KernelStructure::firstOrder:
+        return withBiquadKernel<SampleType, KernelStructure::firstOrder>(type, function);
+    case KernelStructure::notch:
+        return withBiquadKernel<SampleType, KernelStructure::notch>(type, function);
+    case KernelStructure::allPass:
+        return withBiquadKernel<SampleType, KernelStructure::allPass>(type, function);
+    case KernelStructure::general:
+    default:
+        return withBiquadKernel<SampleType, KernelStructure::general>(type, function);
+    }
+}
+
+#endif //BIQUADKERNEL_H_INCLUDED
@@ -0,0 +1,59 @@
+/*
+  ==============================================================================
+
+    BiquadState.cpp
+    Created: 17 Oct 2026 1:02:00am
+    Author:  StoneyDSP
+
+  ==============================================================================
+*/
+
+#include "BiquadState.h"
+
+//==============================================================================
+template <typename SampleType>
+BiquadState<SampleType>::BiquadState()
+{
+    setTransformType(TransformationType::directFormIItransposed);
+}
+
+//==============================================================================
+template <typename SampleType>
+void BiquadState<SampleType>::prepare(size_t newNumChannels)
+{
+    jassert(newNumChannels > 0);
+
+    numChannels = newNumChannels;
+
+    memory.calloc((numChannels * maxNumStates * sizeof(SampleType)) + alignment);
+
+    const auto address = reinterpret_cast<uintptr_t>(memory.get());
+    data = reinterpret_cast<SampleType*>((address + (alignment - 1)) & ~static_cast<uintptr_t>(alignment - 1));
+
+    reset();
+}
+
+template <typename SampleType>
+void BiquadState<SampleType>::setTransformType(transformationType newTransformType) noexcept
+{
+    numStates = getNumStates(newTransformType);
+    reset();
+}
+
+template <typename SampleType>
+void BiquadState<SampleType>::reset(SampleType initialValue) noexcept
+{
+    if (data != nullptr)
+        std::fill(data, data + (numChannels * numStates), initialValue);
+}
+
+template <typename SampleType>
+void BiquadState<SampleType>::snapToZero() noexcept
+{
+    for (auto* element = data; element != data + (numChannels * numStates); ++element)
+        juce::dsp::util::snapToZero(*element);
+}
+
+//==============================================================================
+template class BiquadState<float>;
+template class BiquadState<double>;
@@ -0,0 +1,104 @@
+/*
+  ==============================================================================
+
+    BiquadState.h
+    Created: 17 Oct 2026 1:02:00am
+    Author:  StoneyDSP
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#ifndef BIQUADSTATE_H_INCLUDED
+#define BIQUADSTATE_H_INCLUDED
+
+#include "../JuceLibraryCode/JuceHeader.h"
+
+enum class TransformationType
+{
+    directFormI = 0,
+    directFormII = 1,
+    directFormItransposed = 2,
+    directFormIItransposed = 3
+};
+
+/**
+    Unit-delay storage for a multi-channel biquad.
+
+    All channels live in one cache-aligned allocation, with each channel's
+    delay elements packed next to each other. The stride per channel is the
+    number of delay elements the active transform actually uses:
+
+        DFI   = { Xn1, Xn2, Yn1, Yn2 }
+        DFII  = { Wn1, Wn2 }
+        DFIt  = { Wn1, Wn2, Xn1, Xn2 }
+        DFIIt = { Xn1, Xn2 }
+
+    Room for the widest form is reserved in prepare(), so changing the
+    transform never allocates.
+*/
+template <typename SampleType>
+class BiquadState
+{
+public:
+    using transformationType = TransformationType;
+
+    //==============================================================================
+    /** Constructor. */
+    BiquadState();
+
+    //==============================================================================
+    /** Allocates the state for the given number of channels. */
+    void prepare(size_t newNumChannels);
+
+    /** Sets the transform the state is laid out for, and clears it. */
+    void setTransformType(transformationType newTransformType) noexcept;
+
+    /** Resets the live state variables of every channel. */
+    void reset(SampleType initialValue = SampleType(0.0)) noexcept;
+
+    /** Rounds any live state variables that are denormals to zero. */
+    void snapToZero() noexcept;
+
+    //==============================================================================
+    /** Returns the delay elements of one channel. */
+    SampleType* getChannelPointer(size_t channel) noexcept
+    {
+        jassert(channel < numChannels);
+        return data + (channel * numStates);
+    }
+
+    /** Returns the delay elements of one channel. */
+    const SampleType* getChannelPointer(size_t channel) const noexcept
+    {
+        jassert(channel < numChannels);
+        return data + (channel * numStates);
+    }
+
+    /** Returns the number of prepared channels. */
+    size_t getNumChannels() const noexcept { return numChannels; }
+
+    /** Returns the number of delay elements per channel for the active transform. */
+    size_t getNumStates() const noexcept { return numStates; }
+
+    /** Returns the number of delay elements the given transform uses. */
+    static constexpr size_t getNumStates(transformationType type) noexcept
+    {
+        return (type == TransformationType::directFormII || type == TransformationType::directFormIItransposed) ? 2 : 4;
+    }
+
+    static constexpr size_t maxNumStates = 4;
+    static constexpr size_t alignment = 64;
+
+private:
+    //==============================================================================
+    juce::HeapBlock<char> memory;
+    SampleType* data = nullptr;
+    size_t numChannels = 0, numStates = 2;
+
+    //==============================================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(BiquadState)
+};
+
+#endif //BIQUADSTATE_H_INCLUDED
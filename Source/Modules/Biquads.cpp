@@ -25,7 +25,9 @@ void Biquads<SampleType>::setFrequency(SampleType newFreq)
 
     hz = static_cast<SampleType>(juce::jlimit(minFreq, maxFreq, newFreq));
     frq.setTargetValue(hz);
-    coefficients();
+
+    if (! isSmoothing())
+        coefficients();
 }
 
 template <typename SampleType>
@@ -35,7 +37,9 @@ void Biquads<SampleType>::setResonance(SampleType newRes)
 
     q = static_cast<SampleType>(juce::jlimit(SampleType(0.0), SampleType(1.0), newRes));
     res.setTargetValue(q);
-    coefficients();
+
+    if (! isSmoothing())
+        coefficients();
 }
 
 template <typename SampleType>
@@ -43,7 +47,9 @@ void Biquads<SampleType>::setGain(SampleType newGain)
 {
     g = static_cast<SampleType>(newGain);
     lev.setTargetValue(g);
-    coefficients();
+
+    if (! isSmoothing())
+        coefficients();
 }
 
 template <typename SampleType>
@@ -63,6 +69,7 @@ void Biquads<SampleType>::setTransformType(transformationType newTransformType)
     if (transformType != newTransformType)
     {
         transformType = newTransformType;
+        state.setTransformType(transformType);
         reset(static_cast<SampleType>(0.0));
         coefficients();
     }
@@ -85,6 +92,20 @@ double Biquads<SampleType>::getRampDurationSeconds() const noexcept
     return rampDurationSeconds;
 }
 
+template <typename SampleType>
+void Biquads<SampleType>::setControlRate(int newControlRate) noexcept
+{
+    jassert(newControlRate > 0);
+
+    controlRate = juce::jmax(1, newControlRate);
+}
+
+template <typename SampleType>
+int Biquads<SampleType>::getControlRate() const noexcept
+{
+    return controlRate;
+}
+
 template <typename SampleType>
 bool Biquads<SampleType>::isSmoothing() const noexcept
 {
@@ -103,12 +124,7 @@ void Biquads<SampleType>::prepare(juce::dsp::ProcessSpec& spec)
 
     sampleRate = spec.sampleRate;
 
-    Wn_1.resize(spec.numChannels);
-    Wn_2.resize(spec.numChannels);
-    Xn_1.resize(spec.numChannels);
-    Xn_2.resize(spec.numChannels);
-    Yn_1.resize(spec.numChannels);
-    Yn_2.resize(spec.numChannels);
+    state.prepare(spec.numChannels);
 
     reset(static_cast<SampleType>(0.0));
 
@@ -128,12 +144,12 @@ void Biquads<SampleType>::prepare(juce::dsp::ProcessSpec& spec)
 template <typename SampleType>
 void Biquads<SampleType>::reset(SampleType initialValue)
 {
-    for (auto v : { &Wn_1, &Wn_2, &Xn_1, &Xn_2, &Yn_1, &Yn_2 })
-        std::fill(v->begin(), v->end(), initialValue);
+    state.reset(initialValue);
 
     frq.reset(sampleRate, rampDurationSeconds);
     res.reset(sampleRate, rampDurationSeconds);
     lev.reset(sampleRate, rampDurationSeconds);
+    samplesSinceDesign = 0;
 
     coefficients();
 }
@@ -141,116 +157,71 @@ void Biquads<SampleType>::reset(SampleType initialValue)
 template <typename SampleType>
 SampleType Biquads<SampleType>::processSample(int channel, SampleType inputValue)
 {
-    jassert(juce::isPositiveAndBelow(channel, Wn_1.size()));
-    jassert(juce::isPositiveAndBelow(channel, Wn_2.size()));
-    jassert(juce::isPositiveAndBelow(channel, Xn_1.size()));
-    jassert(juce::isPositiveAndBelow(channel, Xn_2.size()));
-    jassert(juce::isPositiveAndBelow(channel, Yn_1.size()));
-    jassert(juce::isPositiveAndBelow(channel, Yn_1.size()));
-
-
-    switch (transformType)
-    {
-    case TransformationType::directFormI:
-        inputValue = directFormI(channel, inputValue);
-        break;
-    case TransformationType::directFormII:
-        inputValue = directFormII(channel, inputValue);
-        break;
-    case TransformationType::directFormItransposed:
-        inputValue = directFormITransposed(channel, inputValue);
-        break;
-    case TransformationType::directFormIItransposed:
-        inputValue = directFormIITransposed(channel, inputValue);
-        break;
-    default:
-        inputValue = directFormIITransposed(channel, inputValue);
-    }
-
-    return inputValue;
-}
-
-template <typename SampleType>
-SampleType Biquads<SampleType>::directFormI(int channel, SampleType inputValue)
-{
-    auto& Xn1 = Xn_1[(size_t)channel];
-    auto& Xn2 = Xn_2[(size_t)channel];
-    auto& Yn1 = Yn_1[(size_t)channel];
-    auto& Yn2 = Yn_2[(size_t)channel];
-
-    SampleType Xn = inputValue;
-
-    SampleType Yn = ((Xn * b0) + (Xn1 * b1) + (Xn2 * b2) + (Yn1 * a1) + (Yn2 * a2));
-
-    Xn2 = Xn1, Yn2 = Yn1;
-    Xn1 = Xn, Yn1 = Yn;
-
-    return Yn;
-}
-
-template <typename SampleType>
-SampleType Biquads<SampleType>::directFormII(int channel, SampleType inputValue)
-{
-    auto& Wn1 = Wn_1[(size_t)channel];
-    auto& Wn2 = Wn_2[(size_t)channel];
+    jassert(juce::isPositiveAndBelow(channel, state.getNumChannels()));
 
-    SampleType Xn = inputValue;
+    if (channel == 0 && isSmoothing() && ++samplesSinceDesign >= controlRate)
+        smooth(samplesSinceDesign);
 
-    SampleType Wn = (Xn + ((Wn1 * a1) + (Wn2 * a2)));
-    SampleType Yn = ((Wn * b0) + (Wn1 * b1) + (Wn2 * b2));
+    const SampleType c[5] = { b0, b1, b2, a1, a2 };
 
-    Wn2 = Wn1;
-    Wn1 = Wn;
-
-    return Yn;
+    return withBiquadKernel<SampleType>(transformType, getKernelStructure(), [&] (auto kernel)
+    {
+        return decltype(kernel)::processSample(state, static_cast<size_t>(channel), inputValue, c);
+    });
 }
 
 template <typename SampleType>
-SampleType Biquads<SampleType>::directFormITransposed(int channel, SampleType inputValue)
+KernelStructure Biquads<SampleType>::getKernelStructure() const noexcept
 {
-    auto& Wn1 = Wn_1[(size_t)channel];
-    auto& Wn2 = Wn_2[(size_t)channel];
-    auto& Xn1 = Xn_1[(size_t)channel];
-    auto& Xn2 = Xn_2[(size_t)channel];
-
-    SampleType Xn = inputValue;
-
-    SampleType Wn = (Xn + Wn2);
-    SampleType Yn = ((Wn * b0) + Xn2);
-
-    Xn2 = ((Wn * b1) + Xn1), Wn2 = ((Wn * a1) + Wn1);
-    Xn1 = (Wn * b2), Wn1 = (Wn * a2);
-
-    return Yn;
+    switch (filtType)
+    {
+    case filterType::lowPass1:
+    case filterType::highPass1:
+    case filterType::lowShelf1:
+    case filterType::lowShelf1C:
+    case filterType::highShelf1:
+    case filterType::highShelf1C:
+        return KernelStructure::firstOrder;
+    case filterType::notch:
+        return KernelStructure::notch;
+    case filterType::allPass:
+        return KernelStructure::allPass;
+    default:
+        return KernelStructure::general;
+    }
 }
 
 template <typename SampleType>
-SampleType Biquads<SampleType>::directFormIITransposed(int channel, SampleType inputValue)
+void Biquads<SampleType>::smooth(int numSamples)
 {
-    auto& Xn1 = Xn_1[(size_t)channel];
-    auto& Xn2 = Xn_2[(size_t)channel];
+    frq.skip(numSamples);
+    res.skip(numSamples);
+    lev.skip(numSamples);
+    samplesSinceDesign = 0;
 
-    SampleType Xn = inputValue;
-
-    SampleType Yn = ((Xn * b0) + (Xn2));
-
-    Xn2 = ((Xn * b1) + (Xn1)+(Yn * a1));
-    Xn1 = ((Xn * b2) + (Yn * a2));
-
-    return Yn;
+    coefficients();
 }
 
 template <typename SampleType>
 void Biquads<SampleType>::coefficients()
 {
-    SampleType omega = static_cast <SampleType>(frq.getNextValue() * ((pi * two) / sampleRate));
-    SampleType cos = static_cast <SampleType>(std::cos(omega));
-    SampleType sin = static_cast <SampleType>(std::sin(omega));
-    SampleType tan = static_cast <SampleType>(sin / cos);
-    SampleType alpha = static_cast <SampleType>(sin * (one - res.getNextValue()));
-    SampleType a = static_cast <SampleType>(juce::Decibels::decibelsToGain(static_cast<SampleType>(lev.getNextValue() * static_cast <SampleType>(0.5))));
+    SampleType omega = static_cast <SampleType>(frq.getCurrentValue() * ((pi * two) / sampleRate));
+    SampleType sin, cos;
 
-    juce::ignoreUnused(tan);
+    // The fast approximation only serves the steps of a ramp; the design it
+    // settles on is exact. Omega stays below pi (maxFreq is under Nyquist),
+    // inside FastMath::sinCos()'s range.
+    if (isSmoothing())
+    {
+        FastMath<SampleType>::sinCos(omega, sin, cos);
+    }
+    else
+    {
+        sin = std::sin(omega);
+        cos = std::cos(omega);
+    }
+    SampleType alpha = static_cast <SampleType>(sin * (one - res.getCurrentValue()));
+    SampleType a = static_cast <SampleType>(juce::Decibels::decibelsToGain(static_cast<SampleType>(lev.getCurrentValue() * static_cast <SampleType>(0.5))));
 
     auto sqrtA = (std::sqrt(a) * two) * alpha;
 
@@ -466,9 +437,7 @@ void Biquads<SampleType>::coefficients()
 template <typename SampleType>
 void Biquads<SampleType>::snapToZero() noexcept
 {
-    for (auto v : { &Wn_1, &Wn_2, &Xn_1, &Xn_2, &Yn_1, &Yn_2 })
-        for (auto& element : *v)
-            juce::dsp::util::snapToZero(element);
+    state.snapToZero();
 }
 
 //==============================================================================
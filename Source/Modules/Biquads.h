@@ -14,6 +14,9 @@
 #define BIQUADS_H_INCLUDED
 
 #include "../JuceLibraryCode/JuceHeader.h"
+#include "BiquadState.h"
+#include "BiquadKernel.h"
+#include "FastMath.h"
 
 enum class FilterType
 {
@@ -34,14 +37,6 @@ enum class FilterType
     allPass = 14
 };
 
-enum class TransformationType
-{
-    directFormI = 0,
-    directFormII = 1,
-    directFormItransposed = 2,
-    directFormIItransposed = 3
-};
-
 /**
     A handy 2-pole Biquad multi-mode equalizer.
 */
@@ -81,6 +76,13 @@ public:
     /** Returns the ramp duration in seconds. */
     double getRampDurationSeconds() const noexcept;
 
+    /** Sets how many samples pass between designs while smoothing. The
+        coefficients are interpolated linearly in between. */
+    void setControlRate(int newControlRate) noexcept;
+
+    /** Returns the number of samples between designs while smoothing. */
+    int getControlRate() const noexcept;
+
     /** Returns true if the current value is currently being interpolated. */
     bool isSmoothing() const noexcept;
 
@@ -103,31 +105,24 @@ public:
     {
         const auto& inputBlock = context.getInputBlock();
         auto& outputBlock = context.getOutputBlock();
-        const auto numChannels = outputBlock.getNumChannels();
-        const auto numSamples = outputBlock.getNumSamples();
         const auto len = inputBlock.getNumSamples();
 
-        jassert(inputBlock.getNumChannels() == numChannels);
-        jassert(inputBlock.getNumSamples() == numSamples);
+        jassert(inputBlock.getNumChannels() == outputBlock.getNumChannels());
+        jassert(inputBlock.getNumSamples() == outputBlock.getNumSamples());
 
         if (context.isBypassed)
         {
-            frq.skip(static_cast<int> (len));
-            res.skip(static_cast<int> (len));
-            lev.skip(static_cast<int> (len));
+            if (isSmoothing())
+                smooth(static_cast<int> (len));
 
             outputBlock.copyFrom(inputBlock);
             return;
         }
 
-        for (size_t channel = 0; channel < numChannels; ++channel)
+        withBiquadKernel<SampleType>(transformType, getKernelStructure(), [&] (auto kernel)
         {
-            auto* inputSamples = inputBlock.getChannelPointer(channel);
-            auto* outputSamples = outputBlock.getChannelPointer(channel);
-
-            for (size_t i = 0; i < numSamples; ++i)
-                outputSamples[i] = processSample((int)channel, inputSamples[i]);
-        }
+            processBlock<decltype(kernel)>(inputBlock, outputBlock);
+        });
 
 #if JUCE_DSP_ENABLE_SNAP_TO_ZERO
         snapToZero();
@@ -135,7 +130,13 @@ public:
     }
 
     //==============================================================================
-    /** Processes one sample at a time on a given channel. */
+    /** Processes one sample at a time on a given channel. Each call for
+        channel 0 advances the smoothers by a sample, redesigning every
+        controlRate samples while they move, so start each frame there.
+
+        Unlike process(), this does not interpolate between designs: the
+        coefficients step once per controlRate samples. Lower the control
+        rate if the steps are audible in a fast sweep. */
     SampleType processSample(int channel, SampleType inputValue);
 
     double sampleRate = 44100.0, rampDurationSeconds = 0.00005;
@@ -144,13 +145,51 @@ private:
     //==============================================================================
     void coefficients();
 
-    SampleType directFormI(int channel, SampleType inputValue);
+    /** Returns the coefficient relations the filter type guarantees, so that
+        process() can run a reduced kernel. */
+    KernelStructure getKernelStructure() const noexcept;
 
-    SampleType directFormII(int channel, SampleType inputValue);
+    /** Advances the smoothers by a number of samples and redesigns. */
+    void smooth(int numSamples);
 
-    SampleType directFormITransposed(int channel, SampleType inputValue);
+    //==============================================================================
+    /** Runs a whole block through one BiquadKernel, chosen once per block by
+        process().
+
+        While the parameters are smoothing, the block is split into steps of
+        controlRate samples. The design is re-evaluated once per step and the
+        coefficients are interpolated linearly across it.
+    */
+    template <typename Kernel, typename InputBlock, typename OutputBlock>
+    void processBlock(const InputBlock& inputBlock, OutputBlock& outputBlock) noexcept
+    {
+        const auto numSamples = outputBlock.getNumSamples();
 
-    SampleType directFormIITransposed(int channel, SampleType inputValue);
+        size_t start = 0;
+
+        for (; start < numSamples && isSmoothing(); start += static_cast<size_t>(controlRate))
+        {
+            const auto num = juce::jmin(static_cast<size_t>(controlRate), numSamples - start);
+
+            const SampleType c[5] = { b0, b1, b2, a1, a2 };
+            smooth(static_cast<int>(num));
+
+            const auto step = one / static_cast<SampleType>(num);
+            const SampleType d[5] = { (b0 - c[0]) * step, (b1 - c[1]) * step, (b2 - c[2]) * step,
+                                      (a1 - c[3]) * step, (a2 - c[4]) * step };
+
+            auto outputSubBlock = outputBlock.getSubBlock(start, num);
+            Kernel::template process<true>(state, inputBlock.getSubBlock(start, num), outputSubBlock, c, d, true);
+        }
+
+        if (start < numSamples)
+        {
+            const SampleType c[5] = { b0, b1, b2, a1, a2 };
+
+            auto outputSubBlock = outputBlock.getSubBlock(start, numSamples - start);
+            Kernel::process(state, inputBlock.getSubBlock(start, numSamples - start), outputSubBlock, c, true);
+        }
+    }
 
     //==============================================================================
     SampleType getb0() { return static_cast<SampleType>(b0); }
@@ -162,7 +201,7 @@ private:
 
     //==============================================================================
     /** Unit-delay objects. */
-    std::vector<SampleType> Wn_1, Wn_2, Xn_1, Xn_2, Yn_1, Yn_2;
+    BiquadState<SampleType> state;
 
     //==============================================================================
     /** Initialise the coefficient gains. */
@@ -182,6 +221,7 @@ private:
     //==============================================================================
     /** Initialise the parameters. */
     SampleType minFreq = 20.0, maxFreq = 20000.0, hz = 1000.0, q = 0.5, g = 0.0;
+    int controlRate = 32, samplesSinceDesign = 0;
     filterType filtType = filterType::lowPass2;
     transformationType transformType = transformationType::directFormIItransposed;
 
@@ -0,0 +1,165 @@
+/*
+  ==============================================================================
+
+    BlockStateSpace.cpp
+    Created: 17 Oct 2026 10:20:00am
+    Author:  StoneyDSP
+
+  ==============================================================================
+*/
+
+#include <atomic>
+#include "BlockStateSpace.h"
+
+//==============================================================================
+template <typename SampleType>
+BlockStateSpace<SampleType>::BlockStateSpace()
+{
+    update();
+}
+
+//==============================================================================
+template <typename SampleType>
+void BlockStateSpace<SampleType>::setCoefficients(const SampleType (&newCoeffs)[5])
+{
+    if (std::memcmp(coeffs, newCoeffs, sizeof(coeffs)) == 0)
+        return;
+
+    std::memcpy(coeffs, newCoeffs, sizeof(coeffs));
+    lookahead.setCoefficients(coeffs);
+    update();
+}
+
+template <typename SampleType>
+void BlockStateSpace<SampleType>::setChunkSize(size_t newChunkSize)
+{
+    jassert(newChunkSize >= LookaheadKernel<SampleType>::blockSize);
+
+    if (chunkSize != newChunkSize)
+    {
+        chunkSize = juce::jmax(LookaheadKernel<SampleType>::blockSize, newChunkSize);
+        update();
+    }
+}
+
+//==============================================================================
+template <typename SampleType>
+void BlockStateSpace<SampleType>::process(const SampleType* inputSamples, SampleType* outputSamples, size_t numSamples, SampleType& s0, SampleType& s1)
+{
+    if (threadPool == nullptr || numSamples < 2 * chunkSize)
+    {
+        lookahead.processChannel(inputSamples, outputSamples, numSamples, s0, s1);
+        return;
+    }
+
+    const auto numChunks = (numSamples + chunkSize - 1) / chunkSize;
+    const auto chunkLength = [&] (size_t k) { return juce::jmin(chunkSize, numSamples - (k * chunkSize)); };
+
+    chunkS1.assign(numChunks, SampleType(0.0));
+    chunkS0.assign(numChunks, SampleType(0.0));
+
+    chunkS1[0] = s1;
+    chunkS0[0] = s0;
+
+    // Pass 1: the first chunk from the real state, the rest from zero.
+    runTasks(numChunks, [&] (size_t k)
+    {
+        const auto start = k * chunkSize;
+        lookahead.processChannel(inputSamples + start, outputSamples + start, chunkLength(k), chunkS0[k], chunkS1[k]);
+    });
+
+    // Pass 2: carry the true state across the boundaries, with A^L built
+    // from the table; the second row of A^L is a2 times the first of A^(L-1).
+    const auto a2 = coeffs[4];
+    auto carry1 = chunkS1[0], carry0 = chunkS0[0];
+
+    for (size_t k = 1; k < numChunks; ++k)
+    {
+        const auto num = chunkLength(k);
+        const auto end1 = chunkS1[k], end0 = chunkS0[k];
+
+        chunkS1[k] = carry1;
+        chunkS0[k] = carry0;
+
+        const auto next1 = end1 + ((rowS1[num] * carry1) + (rowS0[num] * carry0));
+        const auto next0 = end0 + (a2 * ((rowS1[num - 1] * carry1) + (rowS0[num - 1] * carry0)));
+
+        carry1 = next1;
+        carry0 = next0;
+    }
+
+    s1 = carry1;
+    s0 = carry0;
+
+    // Pass 3: add each later chunk's response to its true starting state.
+    runTasks(numChunks - 1, [&] (size_t task)
+    {
+        const auto k = task + 1;
+        const auto num = chunkLength(k);
+        const auto start1 = chunkS1[k], start0 = chunkS0[k];
+
+        auto* output = outputSamples + (k * chunkSize);
+        const auto* fromS1 = rowS1.data();
+        const auto* fromS0 = rowS0.data();
+
+        for (size_t m = 0; m < num; ++m)
+            output[m] += (fromS1[m] * start1) + (fromS0[m] * start0);
+    });
+}
+
+//==============================================================================
+template <typename SampleType>
+void BlockStateSpace<SampleType>::update()
+{
+    rowS1.resize(chunkSize + 1);
+    rowS0.resize(chunkSize + 1);
+
+    // In double, as in LookaheadKernel; A = { a1, 1 | a2, 0 }.
+    const double a1 = coeffs[3], a2 = coeffs[4];
+    double p00 = 1.0, p01 = 0.0, p10 = 0.0, p11 = 1.0;
+
+    for (size_t m = 0; m <= chunkSize; ++m)
+    {
+        rowS1[m] = static_cast<SampleType>(p00);
+        rowS0[m] = static_cast<SampleType>(p01);
+
+        const auto q00 = (a1 * p00) + p10, q01 = (a1 * p01) + p11;
+        const auto q10 = a2 * p00, q11 = a2 * p01;
+
+        p00 = q00; p01 = q01; p10 = q10; p11 = q11;
+    }
+}
+
+template <typename SampleType>
+void BlockStateSpace<SampleType>::runTasks(size_t numTasks, const std::function<void(size_t)>& task)
+{
+    std::atomic<size_t> nextTask { 0 };
+
+    const std::function<void()> work = [&]
+    {
+        for (auto k = nextTask++; k < numTasks; k = nextTask++)
+            task(k);
+    };
+
+    const auto numJobs = static_cast<size_t>(juce::jmax(0, juce::jmin(threadPool->getNumThreads(), static_cast<int>(numTasks) - 1)));
+
+    while (jobs.size() < numJobs)
+        jobs.push_back(std::make_unique<TaskJob>());
+
+    for (size_t j = 0; j < numJobs; ++j)
+    {
+        jobs[j]->work = &work;
+        threadPool->addJob(jobs[j].get(), false);
+    }
+
+    work();
+
+    // Every task is taken. Withdraw the jobs the pool has not started, and
+    // wait for the others to finish theirs; work and nextTask live here.
+    for (size_t j = 0; j < numJobs; ++j)
+        threadPool->removeJob(jobs[j].get(), false, -1);
+}
+
+//==============================================================================
+template class BlockStateSpace<float>;
+template class BlockStateSpace<double>;
@@ -51,5 +51,62 @@ Coefficient<SampleType>& Coefficient<SampleType>::operator= (SampleType newValue
     return *this;
 }
 
+//==============================================================================
+template <typename SampleType>
+AtomicCoefficientSet<SampleType>::AtomicCoefficientSet(CoefficientSet<SampleType> init)
+    : b0(init.b0), b1(init.b1), b2(init.b2), a1(init.a1), a2(init.a2)
+{
+}
+
+template <typename SampleType>
+AtomicCoefficientSet<SampleType>::~AtomicCoefficientSet()
+{
+    static_assert (std::atomic<SampleType>::is_always_lock_free,
+        "AtomicCoefficientSet requires a lock-free std::atomic<SampleType>");
+}
+
+template <typename SampleType>
+void AtomicCoefficientSet<SampleType>::store(const CoefficientSet<SampleType>& newSet) noexcept
+{
+    const auto seq = sequence.load(std::memory_order_relaxed);
+
+    // An odd sequence marks a store in progress.
+    sequence.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    b0.store(newSet.b0, std::memory_order_relaxed);
+    b1.store(newSet.b1, std::memory_order_relaxed);
+    b2.store(newSet.b2, std::memory_order_relaxed);
+    a1.store(newSet.a1, std::memory_order_relaxed);
+    a2.store(newSet.a2, std::memory_order_relaxed);
+
+    sequence.store(seq + 2, std::memory_order_release);
+}
+
+template <typename SampleType>
+CoefficientSet<SampleType> AtomicCoefficientSet<SampleType>::load() const noexcept
+{
+    CoefficientSet<SampleType> set;
+
+    for (;;)
+    {
+        const auto before = sequence.load(std::memory_order_acquire);
+
+        set.b0 = b0.load(std::memory_order_relaxed);
+        set.b1 = b1.load(std::memory_order_relaxed);
+        set.b2 = b2.load(std::memory_order_relaxed);
+        set.a1 = a1.load(std::memory_order_relaxed);
+        set.a2 = a2.load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if ((before & 1) == 0 && sequence.load(std::memory_order_relaxed) == before)
+            return set;
+    }
+}
+
+//==============================================================================
 template class Coefficient<float>;
 template class Coefficient<double>;
+template class AtomicCoefficientSet<float>;
+template class AtomicCoefficientSet<double>;
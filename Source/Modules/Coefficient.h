@@ -15,7 +15,10 @@
 #ifndef COEFFICIENT_H_INCLUDED
 #define COEFFICIENT_H_INCLUDED
 
+#include <algorithm>
 #include <atomic>
+#include <cmath>
+#include <cstdint>
 
 template <typename SampleType>
 class Coefficient
@@ -47,4 +50,90 @@ private:
     std::atomic<SampleType> value;
 };
 
+//==============================================================================
+/** A complete, normalised set of biquad coefficients, with the feedback terms
+    already negated as the processing kernels expect:
+
+        y[n] = b0 x[n] + b1 x[n-1] + b2 x[n-2] + a1 y[n-1] + a2 y[n-2]
+*/
+template <typename SampleType>
+struct CoefficientSet
+{
+    SampleType b0 = SampleType(1.0), b1 = SampleType(0.0), b2 = SampleType(0.0);
+    SampleType a1 = SampleType(0.0), a2 = SampleType(0.0);
+
+    /** Returns the radius of the larger pole, a root of z^2 - a1 z - a2;
+        under one if the filter is stable. */
+    double getPoleRadius() const noexcept
+    {
+        const double p = a1, q = a2;
+        const auto discriminant = (p * p) + (4.0 * q);
+
+        // A complex pair shares one radius, with r^2 = -a2.
+        if (discriminant < 0.0)
+            return std::sqrt(-q);
+
+        const auto root = std::sqrt(discriminant);
+        return 0.5 * std::max(std::abs(p + root), std::abs(p - root));
+    }
+
+    /** Returns the number of samples the impulse response takes to fall
+        below decay, e.g. 1.0e-5 for 100 dB under a unit impulse, from the
+        pole radius: the two samples of the numerator, plus n for
+        gain r^n = decay, where the numerator's absolute sum bounds the
+        gain of a boost.
+
+        The radius is capped at maxPoleRadius, so the tail is always finite;
+        a filter that does not decay, such as a peak of zero bandwidth with
+        a boost or cut, whose poles sit on the unit circle, gets the longest
+        tail: 1.15e7 samples for decay 1.0e-5 and unit gain, about four
+        minutes at 48 kHz. */
+    double getTailLengthSamples(double decay) const noexcept
+    {
+        const auto radius = getPoleRadius();
+
+        if (radius <= 0.0)
+            return 2.0;
+
+        // Also catches a radius of NaN.
+        const auto decayRadius = radius < maxPoleRadius ? radius : maxPoleRadius;
+
+        const auto gain = std::max(1.0, std::abs(double(b0)) + std::abs(double(b1)) + std::abs(double(b2)));
+
+        return 2.0 + std::ceil(std::log(decay / gain) / std::log(decayRadius));
+    }
+
+    /** The largest pole radius getTailLengthSamples() works from. */
+    static constexpr double maxPoleRadius = 1.0 - 1.0e-6;
+};
+
+/** Publishes CoefficientSets from a single writer thread to any number of
+    reader threads without locking, using a sequence counter (seqlock).
+
+    A reader always gets a set that was stored as a whole, never a mix of
+    two designs. Readers retry only while a store is in progress, and the
+    writer never waits.
+*/
+template <typename SampleType>
+class AtomicCoefficientSet
+{
+public:
+    AtomicCoefficientSet(CoefficientSet<SampleType> init = {});
+    ~AtomicCoefficientSet();
+
+    /** Publishes a new set. Only one thread may store at a time. */
+    void store(const CoefficientSet<SampleType>& newSet) noexcept;
+
+    /** Returns a consistent copy of the most recently stored set. */
+    CoefficientSet<SampleType> load() const noexcept;
+
+    /** Returns the number of sets stored so far. */
+    uint32_t getGeneration() const noexcept { return sequence.load(std::memory_order_acquire) >> 1; }
+
+private:
+    //==============================================================================
+    std::atomic<uint32_t> sequence { 0 };
+    std::atomic<SampleType> b0, b1, b2, a1, a2;
+};
+
 #endif //COEFFICIENT_H_INCLUDED
\ No newline at end of file
@@ -0,0 +1,140 @@
+/*
+  ==============================================================================
+
+    CoefficientCache.cpp
+    Created: 17 Oct 2026 5:45:00am
+    Author:  StoneyDSP
+
+  ==============================================================================
+*/
+
+#include <cstring>
+#include "CoefficientCache.h"
+
+//==============================================================================
+template <typename SampleType>
+CoefficientCache<SampleType>::CoefficientCache()
+{
+    static_assert (std::atomic<SampleType>::is_always_lock_free && std::atomic<double>::is_always_lock_free,
+        "CoefficientCache requires a lock-free std::atomic<SampleType>");
+}
+
+//==============================================================================
+template <typename SampleType>
+bool CoefficientCache<SampleType>::lookup(const Key& key, CoefficientSet<SampleType>& set) noexcept
+{
+    auto* ways = getSet(key);
+
+    for (int way = 0; way < numWays; ++way)
+    {
+        auto& slot = ways[way];
+
+        const auto before = slot.sequence.load(std::memory_order_acquire);
+
+        // An odd sequence marks a store in progress.
+        if ((before & 1) != 0 || ! holds(slot, key))
+            continue;
+
+        CoefficientSet<SampleType> found;
+        found.b0 = slot.b0.load(std::memory_order_relaxed);
+        found.b1 = slot.b1.load(std::memory_order_relaxed);
+        found.b2 = slot.b2.load(std::memory_order_relaxed);
+        found.a1 = slot.a1.load(std::memory_order_relaxed);
+        found.a2 = slot.a2.load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if (slot.sequence.load(std::memory_order_relaxed) != before)
+            continue;
+
+        slot.lastUsed.store(clock.fetch_add(1, std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        set = found;
+
+        return true;
+    }
+
+    return false;
+}
+
+template <typename SampleType>
+void CoefficientCache<SampleType>::insert(const Key& key, const CoefficientSet<SampleType>& set) noexcept
+{
+    auto* ways = getSet(key);
+
+    // Overwrite the key if it is already here, otherwise the least recently
+    // used slot. A racing writer can only make this choice stale, not unsafe.
+    auto* victim = ways;
+
+    for (int way = 0; way < numWays; ++way)
+    {
+        if (holds(ways[way], key))
+        {
+            victim = ways + way;
+            break;
+        }
+
+        if (ways[way].lastUsed.load(std::memory_order_relaxed) < victim->lastUsed.load(std::memory_order_relaxed))
+            victim = ways + way;
+    }
+
+    auto seq = victim->sequence.load(std::memory_order_relaxed);
+
+    if ((seq & 1) != 0 || ! victim->sequence.compare_exchange_strong(seq, seq + 1, std::memory_order_relaxed))
+        return;
+
+    std::atomic_thread_fence(std::memory_order_release);
+
+    victim->sampleRate.store(key.sampleRate, std::memory_order_relaxed);
+    victim->frequency.store(key.frequency, std::memory_order_relaxed);
+    victim->bandwidth.store(key.bandwidth, std::memory_order_relaxed);
+    victim->gain.store(key.gain, std::memory_order_relaxed);
+    victim->backend.store(static_cast<int>(key.backend), std::memory_order_relaxed);
+
+    victim->b0.store(set.b0, std::memory_order_relaxed);
+    victim->b1.store(set.b1, std::memory_order_relaxed);
+    victim->b2.store(set.b2, std::memory_order_relaxed);
+    victim->a1.store(set.a1, std::memory_order_relaxed);
+    victim->a2.store(set.a2, std::memory_order_relaxed);
+
+    victim->lastUsed.store(clock.fetch_add(1, std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    victim->sequence.store(seq + 2, std::memory_order_release);
+}
+
+//==============================================================================
+template <typename SampleType>
+typename CoefficientCache<SampleType>::Slot* CoefficientCache<SampleType>::getSet(const Key& key) noexcept
+{
+    const auto bits = [] (auto x)
+    {
+        uint64_t b = 0;
+        std::memcpy(&b, &x, sizeof(x));
+        return b;
+    };
+
+    // Multiply-xorshift mixing of each field's bit pattern.
+    uint64_t hash = bits(key.sampleRate);
+
+    for (const auto field : { bits(key.frequency), bits(key.bandwidth), bits(key.gain), static_cast<uint64_t>(key.backend) })
+    {
+        hash = (hash ^ field) * 0x9E3779B97F4A7C15ull;
+        hash ^= hash >> 29;
+    }
+
+    return slots + static_cast<size_t>(hash % static_cast<uint64_t>(numSets)) * numWays;
+}
+
+template <typename SampleType>
+bool CoefficientCache<SampleType>::holds(const Slot& slot, const Key& key) noexcept
+{
+    const auto same = [] (auto x, auto y) { return std::memcmp(&x, &y, sizeof(x)) == 0; };
+
+    return same(slot.sampleRate.load(std::memory_order_relaxed), key.sampleRate)
+        && same(slot.frequency.load(std::memory_order_relaxed), key.frequency)
+        && same(slot.bandwidth.load(std::memory_order_relaxed), key.bandwidth)
+        && same(slot.gain.load(std::memory_order_relaxed), key.gain)
+        && slot.backend.load(std::memory_order_relaxed) == static_cast<int>(key.backend);
+}
+
+//==============================================================================
+template class CoefficientCache<float>;
+template class CoefficientCache<double>;
@@ -0,0 +1,61 @@
+/*
+  ==============================================================================
+
+    Denormals.h
+    Created: 17 Oct 2026 12:40:00pm
+    Author:  StoneyDSP
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#ifndef DENORMALS_H_INCLUDED
+#define DENORMALS_H_INCLUDED
+
+#include <type_traits>
+#include "../JuceLibraryCode/JuceHeader.h"
+
+/**
+    How the filters keep denormals out of their recursions.
+
+    Once the input stops, a biquad's delay elements decay geometrically
+    towards zero and pass through the denormal range on the way, where every
+    operation that touches them can cost a hundred cycles or more on x86.
+    The project handles this in three layers, cheapest first:
+
+    1.  Flush to zero. The processor's processBlock() runs under
+        juce::ScopedNoDenormals, which sets FTZ and DAZ in MXCSR on x86 and
+        FZ in FPCR / FPSCR on ARM for the block and restores them after. A
+        denormal result is then written as zero, and the recursion never
+        slows down; the cost is two register writes per block.
+
+    2.  Injection, off unless the build sets
+        ORFANIDISBIQUAD_DENORMAL_INJECTION to 1. Where the flags cannot be
+        set, i.e. on targets that ScopedNoDenormals does not cover, or when
+        a filter runs outside processBlock() on a thread whose mode is
+        cleared, DenormalGuard::inject() adds a DC offset to the input. The delay
+        elements then settle at that offset times their DC gains, far above
+        the denormal range, instead of decaying into it. The offset is far
+        below anything audible, and rounds away against any audible signal.
+
+    3.  Snapping. With JUCE_DSP_ENABLE_SNAP_TO_ZERO, every filter rounds its
+        denormal delay elements to zero after each block, walking only the
+        elements the active form uses; see BiquadState. It is redundant
+        with the first layer, so the project builds with it off.
+*/
+template <typename SampleType>
+struct DenormalGuard
+{
+    /** The injected offset: -300 dB for float, -600 dB for double. */
+    static constexpr SampleType offset = std::is_same_v<SampleType, float> ? SampleType(1.0e-15) : SampleType(1.0e-30);
+
+    /** Adds the offset to every sample of a block. */
+    template <typename BlockType>
+    static void inject(BlockType& block) noexcept
+    {
+        block.add(offset);
+    }
+};
+
+#endif //DENORMALS_H_INCLUDED
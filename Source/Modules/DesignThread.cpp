@@ -0,0 +1,169 @@
+/*
+  ==============================================================================
+
+    DesignThread.cpp
+    Created: 17 Oct 2026 5:10:00am
+    Author:  StoneyDSP
+
+  ==============================================================================
+*/
+
+#include <algorithm>
+#include "DesignThread.h"
+
+//==============================================================================
+DesignThread::DesignThread() : juce::Thread("Coefficient design")
+{
+}
+
+DesignThread::~DesignThread()
+{
+    jassert(clients.empty());
+
+    signalThreadShouldExit();
+    notify();
+    stopThread(1000);
+}
+
+//==============================================================================
+void DesignThread::addClient(Client& client)
+{
+    {
+        const juce::ScopedLock sl(lock);
+
+        jassert(std::find(clients.begin(), clients.end(), &client) == clients.end());
+        clients.push_back(&client);
+        client.owner.store(this, std::memory_order_release);
+    }
+
+    if (! isThreadRunning())
+        startThread();
+}
+
+void DesignThread::removeClient(Client& client)
+{
+    // run() holds the lock for the whole of each callback.
+    const juce::ScopedLock sl(lock);
+
+    clients.erase(std::remove(clients.begin(), clients.end(), &client), clients.end());
+    client.owner.store(nullptr, std::memory_order_release);
+}
+
+void DesignThread::requestDesign(Client& client) noexcept
+{
+    // A flag already up has a signal on its way.
+    if (client.designRequested.exchange(true, std::memory_order_acq_rel))
+        return;
+
+    // Unregistered, the flag waits for addClient().
+    if (auto* thread = client.owner.load(std::memory_order_acquire))
+        thread->notify();
+}
+
+//==============================================================================
+void DesignThread::run()
+{
+    // The event stays signalled until a wait() takes it, so a request made
+    // while the thread is busy is picked up on the next pass.
+    while (! threadShouldExit())
+    {
+        wait(-1);
+
+        const juce::ScopedLock sl(lock);
+
+        for (auto* client : clients)
+            if (client->designRequested.exchange(false, std::memory_order_acquire))
+                client->handleDesignRequest();
+    }
+}
+
+//==============================================================================
+template <typename SampleType>
+AtomicDesignParameters<SampleType>::AtomicDesignParameters(DesignParameters<SampleType> init)
+    : frequency(init.frequency), bandwidth(init.bandwidth), gain(init.gain)
+{
+}
+
+template <typename SampleType>
+AtomicDesignParameters<SampleType>::~AtomicDesignParameters()
+{
+    static_assert (std::atomic<SampleType>::is_always_lock_free,
+        "AtomicDesignParameters requires a lock-free std::atomic<SampleType>");
+}
+
+template <typename SampleType>
+DesignParameters<SampleType> AtomicDesignParameters<SampleType>::load() const noexcept
+{
+    DesignParameters<SampleType> parameters;
+
+    for (;;)
+    {
+        const auto before = sequence.load(std::memory_order_acquire);
+
+        parameters.frequency = frequency.load(std::memory_order_relaxed);
+        parameters.bandwidth = bandwidth.load(std::memory_order_relaxed);
+        parameters.gain = gain.load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if ((before & 1) == 0 && sequence.load(std::memory_order_relaxed) == before)
+            return parameters;
+    }
+}
+
+//==============================================================================
+template <typename SampleType>
+CoefficientQueue<SampleType>::CoefficientQueue() : fifo(capacity)
+{
+}
+
+template <typename SampleType>
+bool CoefficientQueue<SampleType>::push(const CoefficientSet<SampleType>& set) noexcept
+{
+    int start1, size1, start2, size2;
+    fifo.prepareToWrite(1, start1, size1, start2, size2);
+
+    if (size1 == 0)
+        return false;
+
+    sets[start1] = set;
+    fifo.finishedWrite(1);
+
+    return true;
+}
+
+template <typename SampleType>
+bool CoefficientQueue<SampleType>::pop(CoefficientSet<SampleType>& set) noexcept
+{
+    int start1, size1, start2, size2;
+    fifo.prepareToRead(1, start1, size1, start2, size2);
+
+    if (size1 == 0)
+        return false;
+
+    set = sets[start1];
+    fifo.finishedRead(1);
+
+    return true;
+}
+
+template <typename SampleType>
+bool CoefficientQueue<SampleType>::popLatest(CoefficientSet<SampleType>& set) noexcept
+{
+    int start1, size1, start2, size2;
+    fifo.prepareToRead(fifo.getNumReady(), start1, size1, start2, size2);
+
+    if (size1 == 0)
+        return false;
+
+    set = size2 > 0 ? sets[start2 + size2 - 1] : sets[start1 + size1 - 1];
+    fifo.finishedRead(size1 + size2);
+
+    return true;
+}
+
+//==============================================================================
+template class AtomicDesignParameters<float>;
+template class AtomicDesignParameters<double>;
+template class CoefficientQueue<float>;
+template class CoefficientQueue<double>;
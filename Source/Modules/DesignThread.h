@@ -0,0 +1,192 @@
+/*
+  ==============================================================================
+
+    DesignThread.h
+    Created: 17 Oct 2026 5:10:00am
+    Author:  StoneyDSP
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#ifndef DESIGNTHREAD_H_INCLUDED
+#define DESIGNTHREAD_H_INCLUDED
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+#include "../JuceLibraryCode/JuceHeader.h"
+#include "Coefficient.h"
+
+/**
+    A background thread that runs coefficient designs for any number of
+    filters, so that the audio thread never has to.
+
+    One is meant to be shared by every filter in the process, through a
+    juce::SharedResourcePointer<DesignThread>. Filters register as clients,
+    flag themselves with requestDesign() whenever their parameters move, and
+    the thread calls each flagged client back in turn.
+
+    The thread sleeps on its event until a request signals it, and takes its
+    lock only to serve one. requestDesign() signals only when it raises a
+    client's flag, so a burst of requests before the thread gets to them
+    costs one signal.
+*/
+class DesignThread : private juce::Thread
+{
+public:
+    //==============================================================================
+    /** A filter that designs on the DesignThread. */
+    class Client
+    {
+    public:
+        virtual ~Client() = default;
+
+        /** Called on the design thread, once for any number of
+            requestDesign() calls made since the last call. */
+        virtual void handleDesignRequest() = 0;
+
+    private:
+        friend class DesignThread;
+        std::atomic<bool> designRequested { false };
+        std::atomic<DesignThread*> owner { nullptr };
+    };
+
+    //==============================================================================
+    /** Constructor. The thread is started by the first addClient(). */
+    DesignThread();
+
+    /** Destructor. Stops the thread; every client must have been removed. */
+    ~DesignThread() override;
+
+    //==============================================================================
+    /** Registers a client. Call from the message thread. */
+    void addClient(Client& client);
+
+    /** Unregisters a client. Blocks until any design in progress for it has
+        returned, so the client may be destroyed straight after. */
+    void removeClient(Client& client);
+
+    /** Asks for the client to be called back on the design thread. Setting
+        the flag is wait-free; the first request since the last callback
+        also signals the thread, which takes the event's lock briefly. */
+    static void requestDesign(Client& client) noexcept;
+
+private:
+    //==============================================================================
+    void run() override;
+
+    juce::CriticalSection lock;
+    std::vector<Client*> clients;
+
+    //==============================================================================
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(DesignThread)
+};
+
+//==============================================================================
+/** The parameters of one requested design. */
+template <typename SampleType>
+struct DesignParameters
+{
+    SampleType frequency = 1000.0, bandwidth = 1.0, gain = 0.0;
+};
+
+/**
+    Publishes DesignParameters from the threads that set them to the
+    DesignThread, so that a design always sees the three values of one
+    request, never the new frequency of one with the old gain of another.
+
+    A sequence counter (seqlock), as AtomicCoefficientSet, except that any
+    number of threads may write: a writer claims the odd count with a
+    compare-exchange, and spins only while another is mid-store, for the
+    three stores that takes. The design thread's load() never locks.
+*/
+template <typename SampleType>
+class AtomicDesignParameters
+{
+public:
+    //==============================================================================
+    /** Constructor. */
+    AtomicDesignParameters(DesignParameters<SampleType> init = {});
+
+    /** Destructor. */
+    ~AtomicDesignParameters();
+
+    /** Calls change with the current parameters and publishes what it leaves,
+        as one store; a setter changes its own field and keeps the others. */
+    template <typename Function>
+    void update(Function&& change) noexcept
+    {
+        auto seq = sequence.load(std::memory_order_relaxed);
+
+        // An odd sequence marks a store in progress.
+        while ((seq & 1) != 0 || ! sequence.compare_exchange_weak(seq, seq + 1, std::memory_order_acquire, std::memory_order_relaxed))
+            seq = sequence.load(std::memory_order_relaxed);
+
+        DesignParameters<SampleType> parameters { frequency.load(std::memory_order_relaxed),
+                                                  bandwidth.load(std::memory_order_relaxed),
+                                                  gain.load(std::memory_order_relaxed) };
+        change(parameters);
+
+        frequency.store(parameters.frequency, std::memory_order_relaxed);
+        bandwidth.store(parameters.bandwidth, std::memory_order_relaxed);
+        gain.store(parameters.gain, std::memory_order_relaxed);
+
+        sequence.store(seq + 2, std::memory_order_release);
+    }
+
+    /** Returns a consistent copy of the most recently published parameters. */
+    DesignParameters<SampleType> load() const noexcept;
+
+private:
+    //==============================================================================
+    std::atomic<uint32_t> sequence { 0 };
+    std::atomic<SampleType> frequency, bandwidth, gain;
+
+    //==============================================================================
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AtomicDesignParameters)
+};
+
+//==============================================================================
+/**
+    A wait-free single-producer, single-consumer queue of CoefficientSets,
+    for handing designs from the DesignThread to the audio thread.
+
+    Built on juce::AbstractFifo: push() is called only by the design thread,
+    pop() and popLatest() only by the audio thread.
+*/
+template <typename SampleType>
+class CoefficientQueue
+{
+public:
+    //==============================================================================
+    /** Constructor. */
+    CoefficientQueue();
+
+    /** Adds a set. Returns false, and drops it, if the queue is full. */
+    bool push(const CoefficientSet<SampleType>& set) noexcept;
+
+    /** Takes the oldest set. Returns false if the queue is empty. */
+    bool pop(CoefficientSet<SampleType>& set) noexcept;
+
+    /** Empties the queue, keeping only the newest set. Returns false if the
+        queue was empty. */
+    bool popLatest(CoefficientSet<SampleType>& set) noexcept;
+
+    //==============================================================================
+    static constexpr int capacity = 8;
+
+private:
+    //==============================================================================
+    juce::AbstractFifo fifo;
+    CoefficientSet<SampleType> sets[capacity];
+
+    //==============================================================================
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(CoefficientQueue)
+};
+
+#endif //DESIGNTHREAD_H_INCLUDED
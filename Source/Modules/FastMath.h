@@ -0,0 +1,394 @@
+/*
+  ==============================================================================
+
+    FastMath.h
+    Created: 17 Oct 2026 4:05:00am
+    Author:  StoneyDSP
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#ifndef FASTMATH_H_INCLUDED
+#define FASTMATH_H_INCLUDED
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include "../JuceLibraryCode/JuceHeader.h"
+
+enum class MathBackend
+{
+    standard = 0,
+    fast = 1
+};
+
+//==============================================================================
+/** The reference functions used by the coefficient designers. */
+template <typename SampleType>
+struct StandardMath
+{
+    static SampleType square(SampleType x) noexcept { return x * x; }
+
+    static SampleType sqrt(SampleType x) noexcept { return std::sqrt(x); }
+
+    static SampleType tan(SampleType x) noexcept { return std::tan(x); }
+
+    static SampleType decibelsToGain(SampleType decibels) noexcept { return juce::Decibels::decibelsToGain(decibels); }
+};
+
+//==============================================================================
+/**
+    Branch-free approximations of the functions used by the coefficient
+    designers. They make no library calls, so a loop of them can vectorise;
+    see OrfanidisDesign::calculate() for the flags that takes.
+
+    tan() reflects its argument into [0, pi/4] and evaluates a 7th order
+    rational from Lambert's continued fraction. decibelsToGain() evaluates
+    2^x as a polynomial on [-0.5, 0.5] and scales by a power of two built
+    directly in the exponent bits. sqrt() stays std::sqrt, which is already
+    a single instruction and is exact.
+
+    Measured over the designers' argument ranges, tan on [0, 0.49 pi) and
+    gain on +/-24 dB, the worst-case relative errors are:
+
+        tan             double 1.9e-13,  float 1.6e-6
+        decibelsToGain  double 9.4e-12,  float 3.1e-7
+
+    The float tan error comes from reflecting arguments near pi/2; below
+    pi/4 it is 2.2e-7.
+*/
+template <typename SampleType>
+struct FastMath
+{
+    static SampleType square(SampleType x) noexcept { return x * x; }
+
+    static SampleType sqrt(SampleType x) noexcept { return std::sqrt(x); }
+
+    static SampleType tan(SampleType x) noexcept
+    {
+        const SampleType quarterPi = juce::MathConstants<SampleType>::pi * SampleType(0.25);
+        const SampleType halfPi = juce::MathConstants<SampleType>::halfPi;
+
+        // Selects are written as min and copysign, or between values that
+        // are already computed, so that compilers can if-convert them.
+        const auto magnitude = std::abs(x);
+        const auto reflect = magnitude > quarterPi;
+        const auto y = juce::jmin(magnitude, halfPi - magnitude);
+        const auto y2 = y * y;
+
+        const auto num = y * (SampleType(135135.0) + y2 * (SampleType(-17325.0) + y2 * (SampleType(378.0) - y2)));
+        const auto den = SampleType(135135.0) + y2 * (SampleType(-62370.0) + y2 * (SampleType(3150.0) + y2 * SampleType(-28.0)));
+
+        const auto t = (reflect ? den : num) / (reflect ? num : den);
+
+        return std::copysign(t, x);
+    }
+
+    /** Unlike juce::Decibels::decibelsToGain() there is no floor below which
+        the gain is zero: the designers never pass less than -25 dB, and the
+        compare would keep the loop from vectorising. Valid for +/-750 dB. */
+    static SampleType decibelsToGain(SampleType decibels) noexcept
+    {
+        return exp2(decibels * SampleType(0.16609640474436811739));
+    }
+
+    /** Sine and cosine together, for x in [-pi, pi]. The argument is
+        reduced to [-pi/4, pi/4] against pi/2 split in two and both are
+        Taylor series there; the quadrant only swaps and negates them. The
+        worst-case absolute error is 1.6e-16 for double and 8.5e-8 for
+        float, a little over an ulp. */
+    static void sinCos(SampleType x, SampleType& sine, SampleType& cosine) noexcept
+    {
+        const auto n = static_cast<int>(x * SampleType(0.63661977236758134308) + SampleType(2.5)) - 2;
+        const auto k = static_cast<SampleType>(n);
+        SampleType r, s, c;
+
+        if constexpr (std::is_same_v<SampleType, float>)
+            r = (x - k * 1.57079637050628662109f) + k * 4.37113900018624283e-8f;
+        else
+            r = (x - k * 1.5707963267948966192) - k * 6.1232339957367658e-17;
+
+        const auto r2 = r * r;
+
+        if constexpr (std::is_same_v<SampleType, float>)
+        {
+            s = 2.7557319224e-6f;
+            s = s * r2 - 1.9841269841e-4f;
+            s = s * r2 + 8.3333333333e-3f;
+            s = s * r2 - 1.6666666667e-1f;
+
+            c = -2.7557319224e-7f;
+            c = c * r2 + 2.4801587302e-5f;
+            c = c * r2 - 1.3888888889e-3f;
+            c = c * r2 + 4.1666666667e-2f;
+            c = c * r2 - 0.5f;
+        }
+        else
+        {
+            s = -7.6471637318198165e-13;
+            s = s * r2 + 1.6059043836821615e-10;
+            s = s * r2 - 2.5052108385441719e-8;
+            s = s * r2 + 2.7557319223985891e-6;
+            s = s * r2 - 1.9841269841269841e-4;
+            s = s * r2 + 8.3333333333333333e-3;
+            s = s * r2 - 1.6666666666666667e-1;
+
+            c = 4.7794773323873853e-14;
+            c = c * r2 - 1.1470745597729725e-11;
+            c = c * r2 + 2.0876756987868099e-9;
+            c = c * r2 - 2.7557319223985891e-7;
+            c = c * r2 + 2.4801587301587302e-5;
+            c = c * r2 - 1.3888888888888889e-3;
+            c = c * r2 + 4.1666666666666667e-2;
+            c = c * r2 - 0.5;
+        }
+
+        s = r + (r * r2) * s;
+        c = SampleType(1.0) + r2 * c;
+
+        const auto quadrant = n & 3;
+
+        // Rotates by the quadrant through its sine and cosine, which are 0 or
+        // +/-1, so the products are exact and nothing branches.
+        const auto sign = 1 - (quadrant & 2);
+        const auto sk = static_cast<SampleType>((quadrant & 1) * sign);
+        const auto ck = static_cast<SampleType>((1 - (quadrant & 1)) * sign);
+
+        sine = s * ck + c * sk;
+        cosine = c * ck - s * sk;
+    }
+
+    /** 2^x, for x in [-126, 127]. */
+    static SampleType exp2(SampleType x) noexcept
+    {
+        // Rounds to nearest by truncating a positive value, which needs no
+        // library call even without SSE4.1.
+        const auto n = static_cast<int>(x + SampleType(128.5)) - 128;
+        const auto f = x - static_cast<SampleType>(n);
+
+        SampleType p;
+
+        if constexpr (std::is_same_v<SampleType, float>)
+        {
+            p = 1.5403530393381610e-4f;
+            p = p * f + 1.3333558146428443e-3f;
+            p = p * f + 9.6181291076284772e-3f;
+            p = p * f + 5.5504108664821580e-2f;
+            p = p * f + 2.4022650695910071e-1f;
+            p = p * f + 6.9314718055994531e-1f;
+            p = p * f + 1.0f;
+        }
+        else
+        {
+            p = 1.0178086009239699e-7;
+            p = p * f + 1.3215486790144309e-6;
+            p = p * f + 1.5252733804059840e-5;
+            p = p * f + 1.5403530393381610e-4;
+            p = p * f + 1.3333558146428443e-3;
+            p = p * f + 9.6181291076284772e-3;
+            p = p * f + 5.5504108664821580e-2;
+            p = p * f + 2.4022650695910071e-1;
+            p = p * f + 6.9314718055994531e-1;
+            p = p * f + 1.0;
+        }
+
+        return p * powerOfTwo(n);
+    }
+
+private:
+    /** Returns 2^n for n within the normal exponent range. */
+    static SampleType powerOfTwo(int n) noexcept
+    {
+        SampleType result;
+
+        if constexpr (std::is_same_v<SampleType, float>)
+        {
+            const auto bits = static_cast<uint32_t>(n + 127) << 23;
+            std::memcpy(&result, &bits, sizeof(result));
+        }
+        else
+        {
+            const auto bits = static_cast<uint64_t>(n + 1023) << 52;
+            std::memcpy(&result, &bits, sizeof(result));
+        }
+
+        return result;
+    }
+};
+
+//==============================================================================
+/**
+    constexpr versions of the functions used by the coefficient designers,
+    so that a design can be run by the compiler; see
+    OrfanidisDesign::calculateConstexpr(). Too slow to be worth calling at
+    run time.
+
+    Everything is evaluated in double and rounded once to SampleType. sqrt()
+    finishes with one Newton step on the exact residual, tan() reduces its
+    argument against pi/2 split in three and divides Taylor series of sin
+    and cos, carrying each in two doubles, and decibelsToGain() carries the
+    product with ln(10) in two doubles before a Taylor series of exp.
+
+    Against correctly rounded results, over 2000000 random arguments (tan on
+    [0, 0.49 pi), gain on +/-24 dB, sqrt on [2e-9, 5e8]), the worst-case
+    errors are:
+
+        sqrt            0 ulp
+        tan             double 1 ulp, float 0 ulp
+        decibelsToGain  double 1 ulp, float 0 ulp
+*/
+template <typename SampleType>
+struct ConstexprMath
+{
+    static constexpr SampleType square(SampleType x) noexcept { return x * x; }
+
+    static constexpr SampleType sqrt(SampleType x) noexcept { return static_cast<SampleType>(sqrtDouble(static_cast<double>(x))); }
+
+    static constexpr SampleType tan(SampleType x) noexcept { return static_cast<SampleType>(tanDouble(static_cast<double>(x))); }
+
+    /** The same -100 dB floor, and the same rounding of the exponent, as
+        juce::Decibels::decibelsToGain(). */
+    static constexpr SampleType decibelsToGain(SampleType decibels) noexcept
+    {
+        if (! (decibels > SampleType(-100.0)))
+            return SampleType(0.0);
+
+        return static_cast<SampleType>(exp10Double(static_cast<double>(decibels * SampleType(0.05))));
+    }
+
+private:
+    //==============================================================================
+    /** Splits x into two halves of 26 bits each (Veltkamp). */
+    static constexpr void split(double x, double& hi, double& lo) noexcept
+    {
+        const auto t = 134217729.0 * x; // 2^27 + 1
+        hi = t - (t - x);
+        lo = x - hi;
+    }
+
+    /** Returns x + y as an unevaluated sum hi + lo, exactly (Knuth). */
+    static constexpr void twoSum(double x, double y, double& hi, double& lo) noexcept
+    {
+        hi = x + y;
+        const auto v = hi - x;
+        lo = (x - (hi - v)) + (y - v);
+    }
+
+    /** Returns x * y as an unevaluated sum hi + lo, exactly (Dekker). */
+    static constexpr void twoProduct(double x, double y, double& hi, double& lo) noexcept
+    {
+        double xh = 0.0, xl = 0.0, yh = 0.0, yl = 0.0;
+        split(x, xh, xl);
+        split(y, yh, yl);
+
+        hi = x * y;
+        lo = ((xh * yh - hi) + xh * yl + xl * yh) + xl * yl;
+    }
+
+    static constexpr double sqrtDouble(double x) noexcept
+    {
+        if (! (x > 0.0) || x == std::numeric_limits<double>::infinity())
+            return x == 0.0 || x == std::numeric_limits<double>::infinity() ? x : std::numeric_limits<double>::quiet_NaN();
+
+        // Scale into [0.25, 4) by powers of four, which is exact.
+        double scale = 1.0;
+
+        while (x >= 4.0)  { x *= 0.25; scale *= 2.0; }
+        while (x < 0.25)  { x *= 4.0;  scale *= 0.5; }
+
+        auto r = 0.5 * (1.0 + x);
+
+        for (int i = 0; i < 6; ++i)
+            r = 0.5 * (r + x / r);
+
+        double hi = 0.0, lo = 0.0;
+        twoProduct(r, r, hi, lo);
+
+        return (r + ((x - hi) - lo) / (2.0 * r)) * scale;
+    }
+
+    static constexpr double tanDouble(double x) noexcept
+    {
+        // pi/2 in three parts; the first two have trailing zeros, so that
+        // k times them is exact for any argument the designers pass.
+        constexpr double halfPi1 = 1.5707963267341256e+00;
+        constexpr double halfPi2 = 6.0771005065061922e-11;
+        constexpr double halfPi3 = 2.0222662487959506e-21;
+
+        const auto q = x * 0.63661977236758134308;
+        const auto k = static_cast<double>(static_cast<long long>(q < 0.0 ? q - 0.5 : q + 0.5));
+
+        // r = rHi + rLo, the argument less k pi/2, carried in two doubles.
+        double rHi = 0.0, rLo = 0.0;
+        twoSum(x - k * halfPi1, -(k * halfPi2), rHi, rLo);
+        rLo -= k * halfPi3;
+
+        const auto z = rHi * rHi;
+
+        // Taylor series to z^11, summed smallest term first.
+        double s = 0.0, c = 0.0;
+
+        for (int n = 11; n >= 1; --n)
+        {
+            s = -z * (1.0 / ((2.0 * n) * (2.0 * n + 1.0))) * (1.0 + s);
+            c = -z * (1.0 / ((2.0 * n - 1.0) * (2.0 * n))) * (1.0 + c);
+        }
+
+        // sin and cos of r, each again in two doubles, then one corrected
+        // division.
+        double sineHi = 0.0, sineLo = 0.0, cosineHi = 0.0, cosineLo = 0.0;
+        twoSum(rHi, rHi * s + rLo, sineHi, sineLo);
+        twoSum(1.0, c - rHi * rLo, cosineHi, cosineLo);
+
+        const auto odd = (static_cast<long long>(k) & 1) != 0;
+
+        const auto numHi = odd ? cosineHi : sineHi, numLo = odd ? cosineLo : sineLo;
+        const auto denHi = odd ? sineHi : cosineHi, denLo = odd ? sineLo : cosineLo;
+
+        auto t = numHi / denHi;
+
+        double pHi = 0.0, pLo = 0.0;
+        twoProduct(t, denHi, pHi, pLo);
+        t += (((numHi - pHi) - pLo) + numLo - t * denLo) / denHi;
+
+        return odd ? -t : t;
+    }
+
+    static constexpr double exp10Double(double x) noexcept
+    {
+        constexpr double ln10Hi = 2.302585092994045901e+00;
+        constexpr double ln10Lo = -2.1707562233822494e-16;
+
+        // ln(2) in two parts; the first has trailing zeros, so that k times
+        // it is exact.
+        constexpr double ln2Hi = 6.93147180369123816490e-01;
+        constexpr double ln2Lo = 1.90821492927058770002e-10;
+
+        double yHi = 0.0, yLo = 0.0;
+        twoProduct(x, ln10Hi, yHi, yLo);
+        yLo += x * ln10Lo;
+
+        const auto q = yHi * 1.44269504088896340736;
+        const auto k = static_cast<int>(q < 0.0 ? q - 0.5 : q + 0.5);
+
+        const auto r = ((yHi - k * ln2Hi) + yLo) - k * ln2Lo;
+
+        // exp(r) - 1 to r^18, summed smallest term first.
+        double p = 0.0;
+
+        for (int n = 18; n >= 1; --n)
+            p = (r / n) * (1.0 + p);
+
+        auto result = 1.0 + p;
+
+        for (int i = 0; i < k; ++i)  result *= 2.0;
+        for (int i = 0; i < -k; ++i) result *= 0.5;
+
+        return result;
+    }
+};
+
+#endif //FASTMATH_H_INCLUDED
@@ -0,0 +1,120 @@
+/*
+  ==============================================================================
+
+    FixedOrfanidisPeak.h
+    Created: 17 Oct 2026 7:50:00am
+    Author:  StoneyDSP
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#ifndef FIXEDORFANIDISPEAK_H_INCLUDED
+#define FIXEDORFANIDISPEAK_H_INCLUDED
+
+#include "../JuceLibraryCode/JuceHeader.h"
+#include "BiquadState.h"
+#include "BiquadKernel.h"
+#include "OrfanidisDesign.h"
+
+/**
+    An Orfanidis peak whose sample rate, frequency (Hz), bandwidth (0..1) and
+    gain (dB) are template arguments, for curves that never change, e.g.
+
+        FixedOrfanidisPeak<48000, 1000, 1.0, 6.0> correction;
+
+    The design runs once, in the compiler, through
+    OrfanidisDesign::calculateConstexpr(); the coefficients are constants of
+    the class and the transform is fixed, so process() is the BiquadKernel
+    loop with literal coefficients and no design, smoothing or dispatch.
+    Nothing is designed in prepare(), which only sizes the state.
+
+    The arguments may be integers or floating point; floating-point template
+    arguments need C++20.
+*/
+template <auto SampleRate, auto Frequency, auto Bandwidth, auto Gain, typename SampleType = float,
+          TransformationType Type = TransformationType::directFormIItransposed>
+class FixedOrfanidisPeak
+{
+public:
+    using Kernel = BiquadKernel<SampleType, Type>;
+
+    static_assert (SampleRate > 0, "The sample rate must be positive");
+    static_assert (0 < Frequency && Frequency < SampleRate / 2.0, "The frequency must lie between 0 Hz and Nyquist");
+    static_assert (0 < Bandwidth && Bandwidth <= 1, "The bandwidth must lie in (0, 1]");
+
+    //==============================================================================
+    /** The coefficients, designed by the compiler. */
+    static constexpr CoefficientSet<SampleType> coefficients =
+        OrfanidisDesign<SampleType>::calculateConstexpr(static_cast<SampleType>(Frequency), static_cast<SampleType>(Bandwidth), static_cast<SampleType>(Gain),
+                                                        (static_cast<SampleType>(2.0) * juce::MathConstants<SampleType>::pi) / static_cast<SampleType>(SampleRate));
+
+    //==============================================================================
+    /** Constructor. */
+    FixedOrfanidisPeak() = default;
+
+    //==============================================================================
+    /** Initialises the processor. The sample rate must be the one the filter
+        was designed for. */
+    void prepare(const juce::dsp::ProcessSpec& spec)
+    {
+        jassert(spec.sampleRate == static_cast<double>(SampleRate));
+        jassert(spec.numChannels > 0);
+
+        state.setTransformType(Type);
+        state.prepare(spec.numChannels);
+    }
+
+    /** Resets the internal state variables of the processor. */
+    void reset(SampleType initialValue = SampleType(0.0)) noexcept { state.reset(initialValue); }
+
+    /** Ensure that the state variables are rounded to zero if the state
+    variables are denormals. This is only needed if you are doing sample
+    by sample processing.*/
+    void snapToZero() noexcept { state.snapToZero(); }
+
+    //==============================================================================
+    /** Processes the input and output samples supplied in the processing context. */
+    template <typename ProcessContext>
+    void process(const ProcessContext& context) noexcept
+    {
+        const auto& inputBlock = context.getInputBlock();
+        auto& outputBlock = context.getOutputBlock();
+
+        jassert(inputBlock.getNumChannels() == outputBlock.getNumChannels());
+        jassert(inputBlock.getNumSamples() == outputBlock.getNumSamples());
+
+        if (context.isBypassed)
+        {
+            outputBlock.copyFrom(inputBlock);
+            return;
+        }
+
+        Kernel::process(state, inputBlock, outputBlock, coefficientArray, true);
+
+#if JUCE_DSP_ENABLE_SNAP_TO_ZERO
+        snapToZero();
+#endif
+    }
+
+    /** Processes one sample at a time on a given channel. */
+    SampleType processSample(int channel, SampleType inputValue) noexcept
+    {
+        jassert(juce::isPositiveAndBelow(channel, state.getNumChannels()));
+
+        return Kernel::processSample(state, static_cast<size_t>(channel), inputValue, coefficientArray);
+    }
+
+private:
+    //==============================================================================
+    static constexpr SampleType coefficientArray[5] = { coefficients.b0, coefficients.b1, coefficients.b2, coefficients.a1, coefficients.a2 };
+
+    /** Unit-delay objects. */
+    BiquadState<SampleType> state;
+
+    //==============================================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FixedOrfanidisPeak)
+};
+
+#endif //FIXEDORFANIDISPEAK_H_INCLUDED
@@ -0,0 +1,89 @@
+/*
+  ==============================================================================
+
+    LookaheadKernel.cpp
+    Created: 17 Oct 2026 9:10:00am
+    Author:  StoneyDSP
+
+  ==============================================================================
+*/
+
+#include "LookaheadKernel.h"
+
+//==============================================================================
+template <typename SampleType>
+LookaheadKernel<SampleType>::LookaheadKernel()
+{
+    update();
+}
+
+//==============================================================================
+template <typename SampleType>
+void LookaheadKernel<SampleType>::setCoefficients(const SampleType (&newCoeffs)[5]) noexcept
+{
+    if (std::memcmp(coeffs, newCoeffs, sizeof(coeffs)) == 0)
+        return;
+
+    std::memcpy(coeffs, newCoeffs, sizeof(coeffs));
+    update();
+}
+
+template <typename SampleType>
+void LookaheadKernel<SampleType>::update() noexcept
+{
+    const double b0 = coeffs[0], b1 = coeffs[1], b2 = coeffs[2], a1 = coeffs[3], a2 = coeffs[4];
+
+    // A^k, and g = A^k B, stepped together; A = { a1, 1 | a2, 0 }.
+    double p00 = 1.0, p01 = 0.0, p10 = 0.0, p11 = 1.0;
+    double g0 = b1 + (a1 * b0), g1 = b2 + (a2 * b0);
+
+    alignas (SIMDType::SIMDRegisterSize) SampleType rowS1[blockSize], rowS0[blockSize];
+    double impulse[blockSize], toS1[blockSize], toS0[blockSize];
+
+    impulse[0] = b0;
+
+    for (size_t k = 0; k < blockSize; ++k)
+    {
+        rowS1[k] = static_cast<SampleType>(p00);
+        rowS0[k] = static_cast<SampleType>(p01);
+
+        toS1[k] = g0;
+        toS0[k] = g1;
+
+        if (k + 1 < blockSize)
+            impulse[k + 1] = g0;
+
+        const auto q00 = (a1 * p00) + p10, q01 = (a1 * p01) + p11;
+        const auto q10 = a2 * p00, q11 = a2 * p01;
+
+        p00 = q00; p01 = q01; p10 = q10; p11 = q11;
+
+        const auto h0 = (a1 * g0) + g1, h1 = a2 * g0;
+
+        g0 = h0; g1 = h1;
+    }
+
+    fromS1 = SIMDType::fromRawArray(rowS1);
+    fromS0 = SIMDType::fromRawArray(rowS0);
+
+    power[0] = static_cast<SampleType>(p00); power[1] = static_cast<SampleType>(p01);
+    power[2] = static_cast<SampleType>(p10); power[3] = static_cast<SampleType>(p11);
+
+    for (size_t j = 0; j < blockSize; ++j)
+    {
+        alignas (SIMDType::SIMDRegisterSize) SampleType column[blockSize];
+
+        for (size_t k = 0; k < blockSize; ++k)
+            column[k] = k < j ? SampleType(0.0) : static_cast<SampleType>(impulse[k - j]);
+
+        fromInput[j] = SIMDType::fromRawArray(column);
+
+        // Input j reaches the next block's state through A^(blockSize - 1 - j) B.
+        inputToS1[j] = static_cast<SampleType>(toS1[blockSize - 1 - j]);
+        inputToS0[j] = static_cast<SampleType>(toS0[blockSize - 1 - j]);
+    }
+}
+
+//==============================================================================
+template class LookaheadKernel<float>;
+template class LookaheadKernel<double>;
@@ -39,7 +39,7 @@ public:
 
     SampleType sqrt(SampleType x)
     {
-        return (std::exp2(std::log2(x) * static_cast<SampleType>(0.5)));
+        return std::sqrt(x);
     }
 
     SampleType sqrtAmulB(SampleType a, SampleType b) 
@@ -0,0 +1,109 @@
+/*
+  ==============================================================================
+
+    OrfanidisDesign.cpp
+    Created: 17 Oct 2026 3:20:00am
+    Author:  StoneyDSP
+
+  ==============================================================================
+*/
+
+#include "OrfanidisDesign.h"
+
+//==============================================================================
+template <typename SampleType>
+CoefficientSet<SampleType> OrfanidisDesign<SampleType>::calculate(SampleType frequency, SampleType bandwidth, SampleType gain, SampleType omega, MathBackend backend) noexcept
+{
+    if (backend == MathBackend::fast)
+        return design<FastMath<SampleType>>(frequency, bandwidth, gain, omega);
+
+    return design<StandardMath<SampleType>>(frequency, bandwidth, gain, omega);
+}
+
+template <typename SampleType>
+typename OrfanidisDesign<SampleType>::GainTerms OrfanidisDesign<SampleType>::calculateGainTerms(SampleType gain, MathBackend backend) noexcept
+{
+    if (backend == MathBackend::fast)
+        return gainTerms<FastMath<SampleType>>(gain);
+
+    return gainTerms<StandardMath<SampleType>>(gain);
+}
+
+template <typename SampleType>
+typename OrfanidisDesign<SampleType>::FrequencyTerms OrfanidisDesign<SampleType>::calculateFrequencyTerms(SampleType frequency, SampleType omega, MathBackend backend) noexcept
+{
+    if (backend == MathBackend::fast)
+        return frequencyTerms<FastMath<SampleType>>(frequency, omega);
+
+    return frequencyTerms<StandardMath<SampleType>>(frequency, omega);
+}
+
+template <typename SampleType>
+typename OrfanidisDesign<SampleType>::BandwidthTerms OrfanidisDesign<SampleType>::calculateBandwidthTerms(SampleType frequency, SampleType bandwidth, SampleType omega, MathBackend backend) noexcept
+{
+    if (backend == MathBackend::fast)
+        return bandwidthTerms<FastMath<SampleType>>(frequency, bandwidth, omega);
+
+    return bandwidthTerms<StandardMath<SampleType>>(frequency, bandwidth, omega);
+}
+
+template <typename SampleType>
+CoefficientSet<SampleType> OrfanidisDesign<SampleType>::combine(const GainTerms& g, const FrequencyTerms& f, const BandwidthTerms& b, MathBackend backend) noexcept
+{
+    if (backend == MathBackend::fast)
+        return combine<FastMath<SampleType>>(g, f, b);
+
+    return combine<StandardMath<SampleType>>(g, f, b);
+}
+
+//==============================================================================
+template <typename SampleType>
+CoefficientSet<SampleType> OrfanidisDesign<SampleType>::Staged::calculate(SampleType newFrequency, SampleType newBandwidth, SampleType newGain, SampleType newOmega, MathBackend newBackend) noexcept
+{
+    // Bitwise, so that NaN (never designed) always counts as a change.
+    const auto differs = [] (SampleType x, SampleType y) { return std::memcmp(&x, &y, sizeof(SampleType)) != 0; };
+
+    const auto backendChanged = backend != newBackend;
+    const auto frequencyChanged = backendChanged || differs(frq, newFrequency) || differs(omega, newOmega);
+    const auto bandwidthChanged = frequencyChanged || differs(bw, newBandwidth);
+
+    if (backendChanged || differs(gain, newGain))
+        gainTerms = calculateGainTerms(newGain, newBackend);
+
+    if (frequencyChanged)
+        frequencyTerms = calculateFrequencyTerms(newFrequency, newOmega, newBackend);
+
+    if (bandwidthChanged)
+        bandwidthTerms = calculateBandwidthTerms(newFrequency, newBandwidth, newOmega, newBackend);
+
+    frq = newFrequency;
+    bw = newBandwidth;
+    gain = newGain;
+    omega = newOmega;
+    backend = newBackend;
+
+    return combine(gainTerms, frequencyTerms, bandwidthTerms, newBackend);
+}
+
+//==============================================================================
+namespace
+{
+    /** True if a flat peak designs to the identity in the compiler, as a
+        FixedOrfanidisPeak at 0 dB does. */
+    template <typename SampleType>
+    constexpr bool designsFlatAsIdentity(SampleType frequency, SampleType bandwidth) noexcept
+    {
+        const auto omega = (SampleType(2.0) * juce::MathConstants<SampleType>::pi) / SampleType(48000.0);
+        const auto set = OrfanidisDesign<SampleType>::calculateConstexpr(frequency, bandwidth, SampleType(0.0), omega);
+
+        return set.b0 == SampleType(1.0) && set.b1 == SampleType(0.0) && set.b2 == SampleType(0.0)
+            && set.a1 == SampleType(0.0) && set.a2 == SampleType(0.0);
+    }
+
+    static_assert (designsFlatAsIdentity<float>(1000.0f, 1.0f), "A flat peak must design in the compiler");
+    static_assert (designsFlatAsIdentity<double>(1000.0, 1.0), "A flat peak must design in the compiler");
+}
+
+//==============================================================================
+template class OrfanidisDesign<float>;
+template class OrfanidisDesign<double>;
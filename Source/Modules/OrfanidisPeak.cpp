@@ -20,48 +20,88 @@
 template <typename SampleType>
 OrfanidisPeak<SampleType>::OrfanidisPeak() 
     :
-    G0(one), G(zero), GB(zero), w0(zero), Dw(zero),
-    frq(minFreq), res(0.5), gain(zero),
-    loop(zero), outputSample(zero), omega(zero), 
+    frq((SampleType)1000.0), bw((SampleType)1.0), gain((SampleType)0.0),
+    omega((SampleType)0.0),
     minFreq((SampleType)20.0), maxFreq((SampleType)20000.0),
-    transformType(TransformationType::directFormIItransposed),
-    D(zero), C(zero), B(zero), A(zero), G1(zero),
-    G0W2(zero), onePlusW2A(zero), num(zero), den(zero)
+    transformType(TransformationType::directFormIItransposed)
 {
+    frqSmooth.setCurrentAndTargetValue(frq);
+    resSmooth.setCurrentAndTargetValue(bw);
+    gainSmooth.setCurrentAndTargetValue(gain);
+
+    requested.update([this] (auto& p) { p = { frq, bw, gain }; });
+    requestedSampleRate.store(sampleRate);
+
     reset();
 }
 
+template <typename SampleType>
+OrfanidisPeak<SampleType>::~OrfanidisPeak()
+{
+    setDesignThread(nullptr);
+}
+
 //==============================================================================
 template <typename SampleType>
 void OrfanidisPeak<SampleType>::setFrequency(SampleType newFreq)
 {
     jassert(minFreq <= newFreq && newFreq <= maxFreq);
 
-    if (frq != juce::jlimit(minFreq, maxFreq, newFreq))
+    if (designThread != nullptr)
     {
-        frq = newFreq;
-        coefficients();
+        requested.update([newFreq] (auto& p) { p.frequency = newFreq; });
+        DesignThread::requestDesign(*this);
+        return;
     }
+
+    frqSmooth.setTargetValue(juce::jlimit(minFreq, maxFreq, newFreq));
+    parametersChanged = true;
 }
 
 template <typename SampleType>
 void OrfanidisPeak<SampleType>::setResonance(SampleType newRes)
 {
-    if (res != juce::jlimit(SampleType(0.1), SampleType(1.0), newRes))
+    if (designThread != nullptr)
     {
-        res = one / newRes;
-        coefficients();
+        requested.update([newRes] (auto& p) { p.bandwidth = newRes; });
+        DesignThread::requestDesign(*this);
+        return;
     }
+
+    resSmooth.setTargetValue(newRes);
+    parametersChanged = true;
 }
 
 template <typename SampleType>
 void OrfanidisPeak<SampleType>::setGain(SampleType newGain)
 {
-    if (gain != newGain)
+    if (designThread != nullptr)
     {
-        gain = newGain;
-        coefficients();
+        requested.update([newGain] (auto& p) { p.gain = newGain; });
+        DesignThread::requestDesign(*this);
+        return;
     }
+
+    gainSmooth.setTargetValue(newGain);
+    parametersChanged = true;
+}
+
+template <typename SampleType>
+void OrfanidisPeak<SampleType>::setParameters(SampleType newFreq, SampleType newRes, SampleType newGain)
+{
+    jassert(minFreq <= newFreq && newFreq <= maxFreq);
+
+    if (designThread != nullptr)
+    {
+        requested.update([=] (auto& p) { p = { newFreq, newRes, newGain }; });
+        DesignThread::requestDesign(*this);
+        return;
+    }
+
+    frqSmooth.setTargetValue(juce::jlimit(minFreq, maxFreq, newFreq));
+    resSmooth.setTargetValue(newRes);
+    gainSmooth.setTargetValue(newGain);
+    parametersChanged = true;
 }
 
 template <typename SampleType>
@@ -70,11 +110,95 @@ void OrfanidisPeak<SampleType>::setTransformType(transformationType newTransform
     if (transformType != newTransformType)
     {
         transformType = newTransformType;
+        state.setTransformType(transformType);
         reset();
-        coefficients();
     }
 }
 
+template <typename SampleType>
+void OrfanidisPeak<SampleType>::setDesignMode(DesignMode newDesignMode) noexcept
+{
+    designMode = newDesignMode;
+}
+
+template <typename SampleType>
+DesignMode OrfanidisPeak<SampleType>::getDesignMode() const noexcept
+{
+    return designMode;
+}
+
+template <typename SampleType>
+void OrfanidisPeak<SampleType>::setMathBackend(MathBackend newMathBackend) noexcept
+{
+    mathBackend = newMathBackend;
+    requestedBackend.store(newMathBackend);
+}
+
+template <typename SampleType>
+void OrfanidisPeak<SampleType>::setDesignThread(DesignThread* newDesignThread)
+{
+    if (designThread == newDesignThread)
+        return;
+
+    if (designThread != nullptr)
+        designThread->removeClient(*this);
+
+    designThread = newDesignThread;
+
+    if (designThread != nullptr)
+        designThread->addClient(*this);
+}
+
+template <typename SampleType>
+MathBackend OrfanidisPeak<SampleType>::getMathBackend() const noexcept
+{
+    return mathBackend;
+}
+
+//==============================================================================
+template <typename SampleType>
+void OrfanidisPeak<SampleType>::setRampDurationSeconds(double newDurationSeconds) noexcept
+{
+    if (rampDurationSeconds != newDurationSeconds)
+    {
+        rampDurationSeconds = newDurationSeconds;
+
+        frqSmooth.reset(sampleRate, rampDurationSeconds);
+        resSmooth.reset(sampleRate, rampDurationSeconds);
+        gainSmooth.reset(sampleRate, rampDurationSeconds);
+
+        updateParameters(frqSmooth.getTargetValue(), resSmooth.getTargetValue(), gainSmooth.getTargetValue());
+    }
+}
+
+template <typename SampleType>
+double OrfanidisPeak<SampleType>::getRampDurationSeconds() const noexcept
+{
+    return rampDurationSeconds;
+}
+
+template <typename SampleType>
+void OrfanidisPeak<SampleType>::setControlRate(int newControlRate) noexcept
+{
+    jassert(newControlRate > 0);
+
+    controlRate = juce::jmax(1, newControlRate);
+}
+
+template <typename SampleType>
+int OrfanidisPeak<SampleType>::getControlRate() const noexcept
+{
+    return controlRate;
+}
+
+template <typename SampleType>
+bool OrfanidisPeak<SampleType>::isSmoothing() const noexcept
+{
+    bool compSmoothing = frqSmooth.isSmoothing() || resSmooth.isSmoothing() || gainSmooth.isSmoothing();
+
+    return compSmoothing;
+}
+
 //==============================================================================
 template <typename SampleType>
 void OrfanidisPeak<SampleType>::prepare(juce::dsp::ProcessSpec& spec)
@@ -84,12 +208,7 @@ void OrfanidisPeak<SampleType>::prepare(juce::dsp::ProcessSpec& spec)
 
     sampleRate = spec.sampleRate;
 
-    Wn_1.resize(spec.numChannels);
-    Wn_2.resize(spec.numChannels);
-    Xn_1.resize(spec.numChannels);
-    Xn_2.resize(spec.numChannels);
-    Yn_1.resize(spec.numChannels);
-    Yn_2.resize(spec.numChannels);
+    state.prepare(spec.numChannels);
 
     omega = (two * pi) / static_cast <SampleType> (sampleRate);
 
@@ -99,242 +218,184 @@ void OrfanidisPeak<SampleType>::prepare(juce::dsp::ProcessSpec& spec)
     jassert(static_cast <SampleType> (20.0) >= minFreq && minFreq <= static_cast <SampleType> (20000.0));
     jassert(static_cast <SampleType> (20.0) <= maxFreq && maxFreq >= static_cast <SampleType> (20000.0));
 
+    frqSmooth.reset(sampleRate, rampDurationSeconds);
+    resSmooth.reset(sampleRate, rampDurationSeconds);
+    gainSmooth.reset(sampleRate, rampDurationSeconds);
+
+    // The range follows the rate; start inside it rather than ramp into it.
+    frqSmooth.setCurrentAndTargetValue(juce::jlimit(minFreq, maxFreq, frqSmooth.getTargetValue()));
+
+    if (designMode == DesignMode::table)
+        table.prepare(sampleRate);
+    else
+        table.release();
+
     reset();
 
+    requestedSampleRate.store(sampleRate);
+
+    if (designThread != nullptr)
+    {
+        // Audio is stopped, so this thread may stand in as the consumer: drop
+        // any designs for the old rate and start from one for the new. The
+        // request covers a design already in flight with the old omega.
+        CoefficientSet<SampleType> stale;
+        designQueue.popLatest(stale);
+        designDeferred.store(false);
+
+        typename OrfanidisDesign<SampleType>::Staged staged;
+        const auto p = requested.load();
+        coeffs.store(exactDesign(staged, sampleRate, p.frequency, p.bandwidth, p.gain, mathBackend, usingSharedCache));
+        DesignThread::requestDesign(*this);
+        return;
+    }
+
+    // Resetting the smoothers snapped them to their targets; design from there
+    // unconditionally, since omega has changed with the sample rate.
+    frq = frqSmooth.getCurrentValue();
+    bw = resSmooth.getCurrentValue();
+    gain = gainSmooth.getCurrentValue();
+    parametersChanged = false;
     coefficients();
 }
 
 template <typename SampleType>
 void OrfanidisPeak<SampleType>::reset(SampleType initialValue)
 {
-    for (auto v : { &Wn_1, &Wn_2, &Xn_1, &Xn_2, &Yn_1, &Yn_2 })
-        std::fill(v->begin(), v->end(), initialValue);
+    state.reset(initialValue);
 }
 
 template <typename SampleType>
 SampleType OrfanidisPeak<SampleType>::processSample(int channel, SampleType inputValue)
 {
-    jassert(juce::isPositiveAndBelow(channel, Wn_1.size()));
-    jassert(juce::isPositiveAndBelow(channel, Wn_2.size()));
-    jassert(juce::isPositiveAndBelow(channel, Xn_1.size()));
-    jassert(juce::isPositiveAndBelow(channel, Xn_2.size()));
-    jassert(juce::isPositiveAndBelow(channel, Yn_1.size()));
-    jassert(juce::isPositiveAndBelow(channel, Yn_1.size()));
+    jassert(juce::isPositiveAndBelow(channel, state.getNumChannels()));
 
+    if (parametersChanged)
+        applyPendingParameters();
 
-    switch (transformType)
-    {
-    case TransformationType::directFormI:
-        inputValue = directFormI(channel, inputValue);
-        break;
-    case TransformationType::directFormII:
-        inputValue = directFormII(channel, inputValue);
-        break;
-    case TransformationType::directFormItransposed:
-        inputValue = directFormITransposed(channel, inputValue);
-        break;
-    case TransformationType::directFormIItransposed:
-        inputValue = directFormIITransposed(channel, inputValue);
-        break;
-    default:
-        inputValue = directFormIITransposed(channel, inputValue);
-    }
+    CoefficientSet<SampleType> next;
+
+    if (designThread != nullptr && popDesign(next))
+        coeffs.store(next);
+
+    const auto set = coeffs.load();
+    const SampleType c[5] = { set.b0, set.b1, set.b2, set.a1, set.a2 };
 
-    return inputValue;
+    return withBiquadKernel<SampleType>(transformType, [&] (auto kernel)
+    {
+        return decltype(kernel)::processSample(state, static_cast<size_t>(channel), inputValue, c);
+    });
 }
 
 template <typename SampleType>
-SampleType OrfanidisPeak<SampleType>::directFormI(int channel, SampleType inputSample)
+void OrfanidisPeak<SampleType>::updateParameters(SampleType newFreq, SampleType newRes, SampleType newGain)
 {
-    auto& Xn1 = Xn_1[(size_t)channel];
-    auto& Xn2 = Xn_2[(size_t)channel];
-    auto& Yn1 = Yn_1[(size_t)channel];
-    auto& Yn2 = Yn_2[(size_t)channel];
-
-    auto& Xn = inputSample;
-    auto& Yn = outputSample;
-
-    Yn = ((Xn * b[0]) + (Xn1 * b[1]) + (Xn2 * b[2]) + (Yn1 * a[1]) + (Yn2 * a[2]));
-
-    Xn2 = Xn1; 
-    Yn2 = Yn1;
-    Xn1 = Xn; 
-    Yn1 = Yn;
-
-    return Yn;
+    // Bitwise, so that a host re-sending the same value never costs a design.
+    if (differs(frq, newFreq) || differs(bw, newRes) || differs(gain, newGain))
+    {
+        frq = newFreq;
+        bw = newRes;
+        gain = newGain;
+        coefficients();
+    }
 }
 
 template <typename SampleType>
-SampleType OrfanidisPeak<SampleType>::directFormII(int channel, SampleType inputSample)
+void OrfanidisPeak<SampleType>::applyPendingParameters()
 {
-    auto& Wn1 = Wn_1[(size_t)channel];
-    auto& Wn2 = Wn_2[(size_t)channel];
-
-    auto& Wn = loop;
-    auto& Xn = inputSample;
-    auto& Yn = outputSample;
+    parametersChanged = false;
 
-    Wn = (Xn + ((Wn1 * a[1]) + (Wn2 * a[2])));
-    Yn = ((Wn * b[0]) + (Wn1 * b[1]) + (Wn2 * b[2]));
-
-    Wn2 = Wn1;
-    Wn1 = Wn;
-
-    return Yn;
+    if (! isSmoothing())
+        updateParameters(frqSmooth.getCurrentValue(), resSmooth.getCurrentValue(), gainSmooth.getCurrentValue());
 }
 
 template <typename SampleType>
-SampleType OrfanidisPeak<SampleType>::directFormITransposed(int channel, SampleType inputSample)
+void OrfanidisPeak<SampleType>::smooth(int numSamples)
 {
-    auto& Wn1 = Wn_1[(size_t)channel];
-    auto& Wn2 = Wn_2[(size_t)channel];
-    auto& Xn1 = Xn_1[(size_t)channel];
-    auto& Xn2 = Xn_2[(size_t)channel];
-
-    auto& Wn = loop;
-    auto& Xn = inputSample;
-    auto& Yn = outputSample;
+    const auto newFreq = frqSmooth.skip(numSamples);
+    const auto newRes = resSmooth.skip(numSamples);
+    const auto newGain = gainSmooth.skip(numSamples);
 
-    Wn = (Xn + Wn2);
-    Yn = ((Wn * b[0]) + Xn2);
-
-    Xn2 = ((Wn * b[1]) + Xn1); 
-    Wn2 = ((Wn * a[1]) + Wn1);
-    Xn1 = (Wn * b[2]); 
-    Wn1 = (Wn * a[2]);
-
-    return Yn;
+    updateParameters(newFreq, newRes, newGain);
 }
 
 template <typename SampleType>
-SampleType OrfanidisPeak<SampleType>::directFormIITransposed(int channel, SampleType inputSample)
+void OrfanidisPeak<SampleType>::handleDesignRequest()
 {
-    auto& Xn1 = Xn_1[(size_t)channel];
-    auto& Xn2 = Xn_2[(size_t)channel];
-
-    auto& Xn = inputSample;
-    auto& Yn = outputSample;
+    const auto p = requested.load();
+    const auto set = exactDesign(backgroundDesign, requestedSampleRate.load(), p.frequency, p.bandwidth, p.gain,
+                                 requestedBackend.load(), usingSharedCache);
+
+    // The queue only fills while the audio thread is not running. Leave the
+    // request with the audio thread rather than lose the newest design.
+    if (! designQueue.push(set))
+        designDeferred.store(true, std::memory_order_release);
+}
 
-    Yn = ((Xn * b[0]) + (Xn2));
+template <typename SampleType>
+bool OrfanidisPeak<SampleType>::popDesign(CoefficientSet<SampleType>& set) noexcept
+{
+    const auto popped = designQueue.popLatest(set);
 
-    Xn2 = ((Xn * b[1]) + (Xn1) + (Yn * a[1]));
-    Xn1 = ((Xn * b[2]) + (Yn * a[2]));
+    if (designDeferred.load(std::memory_order_acquire) && designDeferred.exchange(false, std::memory_order_acq_rel))
+        DesignThread::requestDesign(*this);
 
-    return Yn;
+    return popped;
 }
 
 template <typename SampleType>
 void OrfanidisPeak<SampleType>::coefficients()
 {
-    G0 = one;
-    G = juce::Decibels::decibelsToGain(gain); // Linear gain
-    GB = juce::Decibels::decibelsToGain(gain / root2); //Bandwidth gain
-    w0 = frq * omega; // RadSampFreq
-    Dw = (frq * omega) / (SampleType(1.588308819) * res); //RadSampBW
-
-    if (G == GB)    // if no boost or cut, pass audio
+    // Flat is the identity in every mode; the table's neighbouring nodes
+    // would only approach it. See OrfanidisDesign::isFlat().
+    if (OrfanidisDesign<SampleType>::isFlat(gain))
     {
-        a_[0] = one;
-        a_[1] = zero;
-        a_[2] = zero;
-        b_[0] = one;
-        b_[1] = zero;
-        b_[2] = zero;
+        coeffs.store({});
+        return;
     }
 
-    else            // else calculate coefficients
+    if (designMode == DesignMode::table && table.covers(frq, bw, gain))
     {
-        calcs();
-
-        a_[0] = one;
-        a_[1] = ((one - G0W2) / onePlusW2A) * minusTwo;
-        a_[2] = ((one + G0W2) - A) / onePlusW2A;
-        b_[0] = ((G1 + G0W2) + B) / onePlusW2A;
-        b_[1] = ((G1 - G0W2) / onePlusW2A) * minusTwo;
-        b_[2] = ((G1 + G0W2) - B) / onePlusW2A;
+        coeffs.store(table.lookup(frq, bw, gain));
+        return;
     }
 
-    a[0] = (one / a_[0]);
-    a[1] = ((-a_[1]) * a[0]);
-    a[2] = ((-a_[2]) * a[0]);
-    b[0] = (b_[0] * a[0]);
-    b[1] = (b_[1] * a[0]);
-    b[2] = (b_[2] * a[0]);
+    if (designMode == DesignMode::surrogate && OrfanidisSurrogate<SampleType>::covers(frq, bw, gain, omega))
+    {
+        coeffs.store(OrfanidisSurrogate<SampleType>::calculate(frq, bw, gain, omega));
+        return;
+    }
 
-    
+    // Settled designs are the ones identical filters have in common; those
+    // along a ramp are unlikely to repeat, and would only evict them.
+    coeffs.store(exactDesign(stagedDesign, sampleRate, frq, bw, gain, mathBackend, usingSharedCache && ! isSmoothing()));
 }
 
 template <typename SampleType>
-void OrfanidisPeak<SampleType>::calcs()
+CoefficientSet<SampleType> OrfanidisPeak<SampleType>::exactDesign(typename OrfanidisDesign<SampleType>::Staged& staged, double rate, SampleType newFreq,
+                                                                  SampleType newRes, SampleType newGain, MathBackend backend, bool shared) noexcept
 {
-    // Functions...
-    const auto mul = [&] (SampleType x, SampleType y) { return x * y; };
-    const auto div = [&] (SampleType x, SampleType y) { return y != (SampleType)0.0 ? x / y : (SampleType)0.0; };
-    const auto powTwo = [&] (SampleType x) { return mul(x, x); };
-    const auto absXminY = [&] (SampleType x, SampleType y) { return (std::abs(x - y)); };
-    const auto sqrtXdivY = [&] (SampleType x, SampleType y) { return (std::sqrt(div(x, y))); };
-    const auto sqrtXmulY = [&] (SampleType x, SampleType y) { return (std::sqrt(mul(x, y))); };
-    const auto powOverTwo = [&] (SampleType x, SampleType y) { return std::pow(x, y); };
-    const auto tanXdivY = [&] (SampleType x, SampleType y) { return std::tan(div(x, y)); };
-
-    // Calcs...
-    const auto& Gpow2 = powTwo(G);
-    const auto& GBpow2 = powTwo(GB);
-    const auto& G0pow2 = powTwo(G0);
-    const auto& piPow2 = powTwo(pi);
-    const auto& w0pow2 = powTwo(w0);
-    const auto& DwPow2 = powTwo(Dw);
-    
-    const auto& F = absXminY(Gpow2, GBpow2);
-    const auto& G00 = absXminY(Gpow2, G0pow2);
-    const auto& F00 = absXminY(GBpow2, G0pow2);
-    
-    const auto& omegaPiTwo = powOverTwo((w0pow2 - piPow2), two);
-    
-    num = G0pow2 * omegaPiTwo + Gpow2 * F00 * piPow2 * DwPow2 / F;
-    den = omegaPiTwo + F00 * piPow2 * DwPow2 / F;
-    
-    G1 = sqrtXdivY(num, den);
-    
-    const auto& G1pow2 = powTwo(G1);
-    
-    const auto& G0G1 = mul(G0, G1);
-    
-    const auto& G01 = absXminY(Gpow2, G0G1);
-    const auto& G11 = absXminY(Gpow2, G1pow2);
-    const auto& F01 = absXminY(GBpow2, G0G1);
-    const auto& F11 = absXminY(GBpow2, G1pow2);
-    
-    const auto& GsqD = sqrtXdivY (G11, G00);
-    const auto& GsqX = sqrtXmulY (G00, G11);
-    const auto& Gsq = G01 - GsqX;
-    
-    const auto& FsqD = sqrtXdivY (F00, F11);
-    const auto& FsqX = sqrtXmulY (F00, F11);
-    const auto& Fsq = F01 - FsqX;
-    
-    const auto& W2 = mul (GsqD, powOverTwo (tanXdivY (w0, two), two));
-    const auto& DW = mul ((one + FsqD * W2), tanXdivY (Dw, two));
-    
-    const auto& DWpow2 = powTwo (DW);
-    
-    G0W2 = mul(G0, W2);
-    
-    C = F11 * DWpow2 - two * W2 * Fsq;
-    D = two * W2 * Gsq;
-    
-    A = sqrtXdivY((C + D), F);
-    B = sqrtXdivY(((Gpow2 * C) + (GBpow2 * D)), F);
-    
-    onePlusW2A = one + W2 + A;
+    const typename CoefficientCache<SampleType>::Key key { rate, newFreq, newRes, newGain, backend };
+
+    CoefficientSet<SampleType> set;
+
+    if (shared && cache->lookup(key, set))
+        return set;
+
+    // Only the terms of the parameters that moved are recomputed. The same
+    // omega as prepare(), so that a design on any thread is bit-identical.
+    set = staged.calculate(newFreq, newRes, newGain, (two * pi) / static_cast <SampleType> (rate), backend);
+
+    if (shared)
+        cache->insert(key, set);
+
+    return set;
 }
 
 template <typename SampleType>
 void OrfanidisPeak<SampleType>::snapToZero() noexcept
 {
-    for (auto v : { &Wn_1, &Wn_2, &Xn_1, &Xn_2, &Yn_1, &Yn_2 })
-        for (auto& element : *v)
-            juce::dsp::util::snapToZero(element);
+    state.snapToZero();
 }
 
 //template <typename SampleType>
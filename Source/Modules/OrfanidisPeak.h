@@ -21,17 +21,24 @@
 
 #include <JuceHeader.h>
 #include "Coefficient.h"
-
-enum class TransformationType
+#include "BiquadState.h"
+#include "BiquadKernel.h"
+#include "LookaheadKernel.h"
+#include "OrfanidisDesign.h"
+#include "OrfanidisTable.h"
+#include "OrfanidisSurrogate.h"
+#include "DesignThread.h"
+#include "CoefficientCache.h"
+
+enum class DesignMode
 {
-    directFormI = 0,
-    directFormII = 1,
-    directFormItransposed = 2,
-    directFormIItransposed = 3
+    exact = 0,
+    table = 1,
+    surrogate = 2
 };
 
 template <typename SampleType>
-class OrfanidisPeak
+class OrfanidisPeak : private DesignThread::Client
 {
 public:
     using transformationType = TransformationType;
@@ -39,6 +46,9 @@ public:
     /** Constructor. */
     OrfanidisPeak();
 
+    /** Destructor. */
+    ~OrfanidisPeak() override;
+
     //==============================================================================
     /** Sets the centre Frequency of the filter. Range = 20..20000 */
     void setFrequency(SampleType newFreq);
@@ -49,11 +59,97 @@ public:
     /** Sets the centre Frequency gain of the filter. Peak and shelf modes only. */
     void setGain(SampleType newGain);
 
+    /** Sets frequency, resonance and gain together. Like the individual
+        setters, the design is deferred to the next processed sample or block,
+        runs at most once however many parameters moved, and is skipped when
+        none of them changed. */
+    void setParameters(SampleType newFreq, SampleType newRes, SampleType newGain);
+
     /** Sets the BiLinear Transform for the filter to use. See enum for available types. */
     void setTransformType(transformationType newTransformType);
 
+    /** Chooses between the exact design, interpolating a precomputed table
+        of designs, and the closed-form OrfanidisSurrogate. The table is taken,
+        shared with every other filter at the same rate, or let go of by the
+        next prepare(); until then, and wherever the table or
+        surrogate does not cover the parameters, the exact design is used. The
+        surrogate needs no memory and no transcendentals, so together with
+        setControlRate(1) it suits modulating at audio rate. See
+        OrfanidisTable and OrfanidisSurrogate for the error bounds. */
+    void setDesignMode(DesignMode newDesignMode) noexcept;
+
+    /** Returns the design mode. */
+    DesignMode getDesignMode() const noexcept;
+
+    /** Chooses the maths used by the exact design. The fast backend avoids
+        library calls; see OrfanidisDesign for its error bound. */
+    void setMathBackend(MathBackend newMathBackend) noexcept;
+
+    /** Returns the maths backend. */
+    MathBackend getMathBackend() const noexcept;
+
+    /** Shares exact designs with every other filter of the same precision in
+        the process, through one CoefficientCache. Designs along a smoothing
+        ramp are not shared. On by default; call before prepare(). */
+    void setUsingSharedCache(bool shouldUseSharedCache) noexcept { usingSharedCache = shouldUseSharedCache; }
+
+    /** Returns true if exact designs are shared through the cache. */
+    bool isUsingSharedCache() const noexcept { return usingSharedCache; }
+
+    /** Moves the design onto a background thread, or back onto the audio
+        thread if nullptr. Call from the message thread, before prepare().
+
+        While a design thread is set, the parameter setters may be called
+        from any thread: they only publish the new values and flag the
+        filter to the thread, which runs the exact design and hands the
+        finished set over through a wait-free queue. The audio thread picks
+        up the newest set at the start of each block and ramps the
+        coefficients to it across the block, in place of the parameter
+        smoothers; it never designs. The table design mode is not used.
+    */
+    void setDesignThread(DesignThread* newDesignThread);
+
+    /** Returns the design thread, or nullptr if designing on the audio thread. */
+    DesignThread* getDesignThread() const noexcept { return designThread; }
+
+    /** Enables processing groups of channels in parallel SIMD lanes, with a
+        last partial group, e.g. stereo, in a zero-padded register. A lone
+        channel is processed on its own. */
+    void setVectorised(bool shouldBeVectorised) noexcept { vectorised = shouldBeVectorised; }
+
+    /** Returns true if channels are being processed in SIMD lanes. */
+    bool isVectorised() const noexcept { return vectorised; }
+
+    /** Runs the channels that do not fill SIMD lanes, i.e. mono and stereo,
+        through LookaheadKernel, several samples per step, whenever the
+        transform is DFIIt and the coefficients are not ramping. Off by
+        default, as the output is close to but not bit-exact with the
+        per-sample kernel; see LookaheadKernel for the tolerance. */
+    void setUsingLookahead(bool shouldUseLookahead) noexcept { usingLookahead = shouldUseLookahead; }
+
+    /** Returns true if the lookahead kernel is used where it applies. */
+    bool isUsingLookahead() const noexcept { return usingLookahead; }
+
+    //==============================================================================
+    /** Sets the length of the ramp used for smoothing parameter changes. */
+    void setRampDurationSeconds(double newDurationSeconds) noexcept;
+
+    /** Returns the ramp duration in seconds. */
+    double getRampDurationSeconds() const noexcept;
+
+    /** Sets how many samples pass between designs while smoothing. The
+        coefficients are interpolated linearly in between. */
+    void setControlRate(int newControlRate) noexcept;
+
+    /** Returns the number of samples between designs while smoothing. */
+    int getControlRate() const noexcept;
+
+    /** Returns true if the current value is currently being interpolated. */
+    bool isSmoothing() const noexcept;
+
     //==============================================================================
-    /** Initialises the processor. */
+    /** Initialises the processor, starting at the parameters last set
+        rather than ramping to them; set them first. */
     void prepare(juce::dsp::ProcessSpec& spec);
 
     /** Resets the internal state variables of the processor. */
@@ -71,11 +167,9 @@ public:
     {
         const auto& inputBlock = context.getInputBlock();
         auto& outputBlock = context.getOutputBlock();
-        const auto numChannels = outputBlock.getNumChannels();
-        const auto numSamples = outputBlock.getNumSamples();
 
-        jassert(inputBlock.getNumChannels() == numChannels);
-        jassert(inputBlock.getNumSamples() == numSamples);
+        jassert(inputBlock.getNumChannels() == outputBlock.getNumChannels());
+        jassert(inputBlock.getNumSamples() == outputBlock.getNumSamples());
 
         if (context.isBypassed)
         {
@@ -83,14 +177,13 @@ public:
             return;
         }
 
-        for (size_t channel = 0; channel < numChannels; ++channel)
-        {
-            auto* inputSamples = inputBlock.getChannelPointer(channel);
-            auto* outputSamples = outputBlock.getChannelPointer(channel);
+        if (parametersChanged)
+            applyPendingParameters();
 
-            for (size_t i = 0; i < numSamples; ++i)
-                outputSamples[i] = processSample((int)channel, inputSamples[i]);
-        }
+        withBiquadKernel<SampleType>(transformType, [&] (auto kernel)
+        {
+            processBlock<decltype(kernel)>(inputBlock, outputBlock);
+        });
 
 #if JUCE_DSP_ENABLE_SNAP_TO_ZERO
         snapToZero();
@@ -101,47 +194,182 @@ public:
     /** Processes one sample at a time on a given channel. */
     SampleType processSample(int channel, SampleType inputValue);
 
+    //==============================================================================
+    /** Returns the current coefficient set. Safe to call from any thread, i.e. the display thread. */
+    CoefficientSet<SampleType> getCoefficients() const noexcept { return coeffs.load(); }
+
 private:
     //==============================================================================
     void coefficients();
 
-    void calcs();
+    /** Returns true if two values differ in any bit. */
+    static bool differs(SampleType x, SampleType y) noexcept { return std::memcmp(&x, &y, sizeof(SampleType)) != 0; }
 
-    SampleType directFormI(int channel, SampleType inputValue);
-    SampleType directFormII(int channel, SampleType inputValue);
-    SampleType directFormITransposed(int channel, SampleType inputValue);
-    SampleType directFormIITransposed(int channel, SampleType inputValue);
+    /** Applies a new set of design parameters, redesigning only if one changed bitwise. */
+    void updateParameters(SampleType newFreq, SampleType newRes, SampleType newGain);
 
-    //==========================================================================
-    /** Coefficient current value. Safe to pass i.e. to the display thread */
-    /*SampleType geta0() { return a[0]; }
-    SampleType getb0() { return b[0]; }
-    SampleType geta1() { return a[1]; }
-    SampleType getb1() { return b[1]; }
-    SampleType geta2() { return a[2]; }
-    SampleType getb2() { return b[2]; }*/
+    /** Designs from the smoothers' current values if any setter was called. */
+    void applyPendingParameters();
+
+    /** Advances the smoothers by a number of samples and redesigns. */
+    void smooth(int numSamples);
+
+    /** Runs the exact design through the given staged terms. If shared, the
+        cache is looked up first and filled after. */
+    CoefficientSet<SampleType> exactDesign(typename OrfanidisDesign<SampleType>::Staged& staged, double rate, SampleType newFreq,
+                                           SampleType newRes, SampleType newGain, MathBackend backend, bool shared) noexcept;
+
+    /** Designs from the published parameters, on the design thread. */
+    void handleDesignRequest() override;
+
+    /** The audio thread's side of the handoff: takes the newest finished
+        design, if any, and asks again for one that found the queue full. */
+    bool popDesign(CoefficientSet<SampleType>& set) noexcept;
+
+    //==============================================================================
+    /** Runs a whole block through one BiquadKernel, chosen once per block by
+        process().
+
+        With a design thread, a newly finished design is ramped to across
+        the whole block instead.
+
+        While the parameters are smoothing, the block is split into steps of
+        controlRate samples. The design is re-evaluated once per step and the
+        coefficients are interpolated linearly across it.
+
+        What is left once they settle runs with fixed coefficients, or, at
+        0 dB, where the design is the identity, through the kernel's
+        processIdentity(), which only copies.
+    */
+    template <typename Kernel, typename InputBlock, typename OutputBlock>
+    void processBlock(const InputBlock& inputBlock, OutputBlock& outputBlock) noexcept
+    {
+        const auto numSamples = outputBlock.getNumSamples();
+
+        CoefficientSet<SampleType> to;
+
+        if (designThread != nullptr && popDesign(to))
+        {
+            const auto from = coeffs.load();
+            coeffs.store(to);
+
+            if (numSamples > 0)
+            {
+                const auto step = static_cast<SampleType>(1.0) / static_cast<SampleType>(numSamples);
+
+                const SampleType c[5] = { from.b0, from.b1, from.b2, from.a1, from.a2 };
+                const SampleType d[5] = { (to.b0 - from.b0) * step, (to.b1 - from.b1) * step, (to.b2 - from.b2) * step,
+                                          (to.a1 - from.a1) * step, (to.a2 - from.a2) * step };
+
+                Kernel::template process<true>(state, inputBlock, outputBlock, c, d, vectorised);
+            }
+
+            return;
+        }
+
+        size_t start = 0;
+
+        for (; start < numSamples && isSmoothing(); start += static_cast<size_t>(controlRate))
+        {
+            const auto num = juce::jmin(static_cast<size_t>(controlRate), numSamples - start);
+
+            const auto from = coeffs.load();
+            smooth(static_cast<int>(num));
+            const auto to = coeffs.load();
+
+            const auto step = static_cast<SampleType>(1.0) / static_cast<SampleType>(num);
+
+            const SampleType c[5] = { from.b0, from.b1, from.b2, from.a1, from.a2 };
+            const SampleType d[5] = { (to.b0 - from.b0) * step, (to.b1 - from.b1) * step, (to.b2 - from.b2) * step,
+                                      (to.a1 - from.a1) * step, (to.a2 - from.a2) * step };
+
+            auto outputSubBlock = outputBlock.getSubBlock(start, num);
+            Kernel::template process<true>(state, inputBlock.getSubBlock(start, num), outputSubBlock, c, d, vectorised);
+        }
+
+        if (start < numSamples)
+        {
+            const auto set = coeffs.load();
+            const SampleType c[5] = { set.b0, set.b1, set.b2, set.a1, set.a2 };
+
+            auto outputSubBlock = outputBlock.getSubBlock(start, numSamples - start);
+
+            if (Kernel::isIdentity(c))
+            {
+                Kernel::processIdentity(state, inputBlock.getSubBlock(start, numSamples - start), outputSubBlock, c);
+                return;
+            }
+
+            if constexpr (Kernel::type == TransformationType::directFormIItransposed)
+            {
+                if (usingLookahead)
+                {
+                    lookahead.setCoefficients(c);
+                    lookahead.process(state, inputBlock.getSubBlock(start, numSamples - start), outputSubBlock, vectorised);
+                    return;
+                }
+            }
+
+            Kernel::process(state, inputBlock.getSubBlock(start, numSamples - start), outputSubBlock, c, vectorised);
+        }
+    }
 
     //==============================================================================
     /** Unit-delay objects. */
-    std::vector<SampleType> Wn_1, Wn_2, Xn_1, Xn_2, Yn_1, Yn_2;
+    BiquadState<SampleType> state;
+
+    /** Block matrices for the lookahead kernel, rebuilt when the coefficients change. */
+    LookaheadKernel<SampleType> lookahead;
 
     //==========================================================================
-    /** Coefficient gain */
-    Coefficient<SampleType> a[3] = { 1.0, 0.0, 0.0 }, b[3] = { 1.0, 0.0, 0.0 };
+    /** Coefficient gain, published as one set per design. */
+    AtomicCoefficientSet<SampleType> coeffs;
+
+    /** Precomputed designs, for the table design mode. */
+    OrfanidisTable<SampleType> table;
+
+    /** Intermediate design terms, kept between designs. */
+    typename OrfanidisDesign<SampleType>::Staged stagedDesign;
 
-    /** Coefficient calculation */
-    SampleType a_[3] = { 1.0, 0.0, 0.0 }, b_[3] = { 1.0, 0.0, 0.0 };
-    Coefficient<SampleType> G0, G, GB, w0, Dw;
+    /** Designs shared by every filter of this precision in the process. */
+    juce::SharedResourcePointer<CoefficientCache<SampleType>> cache;
+    bool usingSharedCache = true;
+
+    //==============================================================================
+    /** Background design. The requested values are written by the setters
+        and read by the design thread, which alone uses backgroundDesign;
+        the parameters are published as one, so a design never mixes two
+        requests. */
+    DesignThread* designThread = nullptr;
+    CoefficientQueue<SampleType> designQueue;
+    typename OrfanidisDesign<SampleType>::Staged backgroundDesign;
+    AtomicDesignParameters<SampleType> requested;
+    std::atomic<double> requestedSampleRate;
+    std::atomic<MathBackend> requestedBackend { MathBackend::standard };
+
+    /** Set by the design thread when the queue was full. The request then
+        waits for the audio thread to make room, instead of redesigning in a
+        loop while audio is stopped. */
+    std::atomic<bool> designDeferred { false };
+
+    //==============================================================================
+    /** Parameter Smoothers. */
+    juce::SmoothedValue<SampleType, juce::ValueSmoothingTypes::Multiplicative> frqSmooth;
+    juce::SmoothedValue<SampleType, juce::ValueSmoothingTypes::Linear> resSmooth;
+    juce::SmoothedValue<SampleType, juce::ValueSmoothingTypes::Linear> gainSmooth;
+
+    double rampDurationSeconds = 0.0;
+    int controlRate = 32;
+    bool parametersChanged = false;
 
     //==========================================================================
     /** Initialised parameter */
-    SampleType frq, res, gain;
-    SampleType loop, outputSample, omega, minFreq, maxFreq;
+    SampleType frq, bw, gain;
+    SampleType omega, minFreq, maxFreq;
     transformationType transformType;
-
-    SampleType D, C, B, A, G1;
-    SampleType G0W2, onePlusW2A;
-    SampleType num, den;
+    DesignMode designMode = DesignMode::exact;
+    MathBackend mathBackend = MathBackend::standard;
+    bool vectorised = true, usingLookahead = false;
 
     //==========================================================================
     /** Initialised constant */
@@ -0,0 +1,175 @@
+/*
+  ==============================================================================
+
+    OrfanidisSurrogate.cpp
+    Created: 17 Oct 2026 6:30:00am
+    Author:  StoneyDSP
+
+  ==============================================================================
+*/
+
+#include <array>
+#include <limits>
+#include "OrfanidisSurrogate.h"
+#include "OrfanidisSurrogateData.h"
+#include "OrfanidisDesign.h"
+
+namespace
+{
+    using namespace OrfanidisSurrogateData;
+
+    //==============================================================================
+    constexpr int numNodes = degree + 1;
+    constexpr int numTerms = numNodes * numNodes * numNodes;
+    constexpr int numOutputs = 4;
+    constexpr int numPatches = numFrequencyPatches * numBandwidthPatches * numGainPatches;
+
+    /** The fitted coefficients in SampleType, converted at compile time and
+        interleaved by output, so the four cubics of a patch evaluate as one. */
+    template <typename SampleType>
+    constexpr std::array<SampleType, numPatches * numOutputs * numTerms> convertCoefficients() noexcept
+    {
+        std::array<SampleType, numPatches * numOutputs * numTerms> result {};
+        size_t index = 0;
+
+        for (int f = 0; f < numFrequencyPatches; ++f)
+            for (int b = 0; b < numBandwidthPatches; ++b)
+                for (int g = 0; g < numGainPatches; ++g)
+                    for (int t = 0; t < numTerms; ++t)
+                        for (int o = 0; o < numOutputs; ++o)
+                            result[index++] = static_cast<SampleType>(coefficients[f][b][g][o][t]);
+
+        return result;
+    }
+
+    template <typename SampleType>
+    constexpr auto patches = convertCoefficients<SampleType>();
+
+    /** Maps each patch of one axis onto [-1, 1] as t = x * scale - offset. */
+    template <typename SampleType, int numEdges>
+    struct Axis
+    {
+        constexpr explicit Axis(const double (&edges)[numEdges]) noexcept
+        {
+            for (int n = 0; n + 1 < numEdges; ++n)
+            {
+                lower[n] = static_cast<SampleType>(edges[n]);
+                scale[n] = static_cast<SampleType>(2.0 / (edges[n + 1] - edges[n]));
+                offset[n] = static_cast<SampleType>((edges[n] + edges[n + 1]) / (edges[n + 1] - edges[n]));
+            }
+        }
+
+        /** Returns the patch holding x, and x in its local coordinate. */
+        int locate(SampleType x, SampleType& t) const noexcept
+        {
+            int n = 0;
+
+            while (n + 2 < numEdges && x >= lower[n + 1])
+                ++n;
+
+            t = x * scale[n] - offset[n];
+            return n;
+        }
+
+        SampleType lower[numEdges - 1] {}, scale[numEdges - 1] {}, offset[numEdges - 1] {};
+    };
+
+    template <typename SampleType>
+    constexpr Axis<SampleType, numFrequencyPatches + 1> frequencyAxis { frequencyEdges };
+
+    template <typename SampleType>
+    constexpr Axis<SampleType, numBandwidthPatches + 1> bandwidthAxis { bandwidthEdges };
+
+    template <typename SampleType>
+    constexpr Axis<SampleType, numGainPatches + 1> gainAxis { gainEdges };
+}
+
+//==============================================================================
+template <typename SampleType>
+bool OrfanidisSurrogate<SampleType>::covers(SampleType frequency, SampleType bandwidth, SampleType gain, SampleType omega) noexcept
+{
+    const auto w0 = frequency * omega;
+
+    return static_cast<SampleType>(0.0) < w0 && w0 <= static_cast<SampleType>(frequencyEdges[numFrequencyPatches])
+        && static_cast<SampleType>(bandwidthEdges[0]) <= bandwidth && bandwidth <= static_cast<SampleType>(bandwidthEdges[numBandwidthPatches])
+        && static_cast<SampleType>(gainEdges[0]) <= gain && gain <= static_cast<SampleType>(gainEdges[numGainPatches]);
+}
+
+template <typename SampleType>
+CoefficientSet<SampleType> OrfanidisSurrogate<SampleType>::calculate(SampleType frequency, SampleType bandwidth, SampleType gain, SampleType omega) noexcept
+{
+    jassert(covers(frequency, bandwidth, gain, omega));
+
+    const SampleType one = 1.0, two = 2.0;
+
+    // Where the exact design is a pass-through, match it.
+    if (OrfanidisDesign<SampleType>::isFlat(gain))
+        return {};
+
+    const auto w0 = frequency * omega;
+
+    SampleType x, y, z;
+    const auto f = frequencyAxis<SampleType>.locate(w0, x);
+    const auto b = bandwidthAxis<SampleType>.locate(bandwidth, y);
+    const auto g = gainAxis<SampleType>.locate(gain, z);
+
+    const auto* patch = patches<SampleType>.data() + static_cast<size_t>((f * numBandwidthPatches + b) * numGainPatches + g) * numOutputs * numTerms;
+
+    SampleType terms[numOutputs];
+    evaluate(patch, x, y, z, terms);
+
+    // Clamping A and W2 above zero keeps both poles inside the unit circle.
+    const auto tiny = std::numeric_limits<SampleType>::min();
+
+    const auto W2 = juce::jmax(tiny, w0 * w0 * terms[0]);
+    const auto A = juce::jmax(tiny, w0 * bandwidth * terms[1]);
+    const auto B = w0 * bandwidth * terms[2];
+    const auto G1 = one + terms[3];
+
+    const auto a0 = one / (one + W2 + A);
+
+    CoefficientSet<SampleType> set;
+    set.b0 = (G1 + W2 + B) * a0;
+    set.b1 = -two * (G1 - W2) * a0;
+    set.b2 = (G1 + W2 - B) * a0;
+    set.a1 = two * (one - W2) * a0;
+    set.a2 = -(one + W2 - A) * a0;
+
+    return set;
+}
+
+template <typename SampleType>
+void OrfanidisSurrogate<SampleType>::evaluate(const SampleType* fit, SampleType x, SampleType y, SampleType z, SampleType* terms) noexcept
+{
+    // Horner in z, then y, then x, on all four outputs at once.
+    SampleType px[numOutputs] = {};
+
+    for (int i = degree; i >= 0; --i)
+    {
+        SampleType py[numOutputs] = {};
+
+        for (int j = degree; j >= 0; --j)
+        {
+            const auto* c = fit + (i * numNodes + j) * numNodes * numOutputs;
+
+            SampleType pz[numOutputs] = {};
+
+            for (int k = degree; k >= 0; --k)
+                for (int o = 0; o < numOutputs; ++o)
+                    pz[o] = pz[o] * z + c[k * numOutputs + o];
+
+            for (int o = 0; o < numOutputs; ++o)
+                py[o] = py[o] * y + pz[o];
+        }
+
+        for (int o = 0; o < numOutputs; ++o)
+            px[o] = px[o] * x + py[o];
+    }
+
+    for (int o = 0; o < numOutputs; ++o)
+        terms[o] = px[o];
+}
+
+//==============================================================================
+template class OrfanidisSurrogate<float>;
+template class OrfanidisSurrogate<double>;
@@ -0,0 +1,937 @@
+/*
+  ==============================================================================
+
+    OrfanidisSurrogateData.h
+    Generated by Tools/OrfanidisSurrogateFit.cpp - do not edit.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#ifndef ORFANIDISSURROGATEDATA_H_INCLUDED
+#define ORFANIDISSURROGATEDATA_H_INCLUDED
+
+namespace OrfanidisSurrogateData
+{
+    constexpr int degree = 3;
+    constexpr int numFrequencyPatches = 3, numBandwidthPatches = 2, numGainPatches = 2;
+
+    constexpr double frequencyEdges[] = { 0, 1, 1.5, 2.0420352248333655 };
+    constexpr double bandwidthEdges[] = { 0.0625, 0.25, 1 };
+    constexpr double gainEdges[] = { -24.082399653100001, 0, 24.082399653100001 };
+
+    /** [frequency][bandwidth][gain patch][output][(i * 4 + j) * 4 + k], the
+        coefficient of t_w0^i t_bw^j t_gain^k. */
+    constexpr double coefficients[3][2][2][4][64] =
+    {
+        {
+            {
+                {
+                    {
+                        0.26038345466524077, 0.00057976664327059663, -0.00068213046340476994, 0.00037730580092048329,
+                        -0.00040707041748003512, 0.00069462650397709785, -0.00081089920308042218, 0.00044603611046473547,
+                        -0.00012246854214541573, 0.00020697840136037795, -0.00023226699088445193, 0.00012403775171587365,
+                        -2.3511580435297369e-07, -7.7803186749005396e-07, 6.5571327645077362e-06, -5.8631636692249265e-06,
+                        0.021612652540905528, 0.0012914404571482655, -0.00149449744496379, 0.00081712343124395309,
+                        -0.00091113574560524008, 0.0015398314127113928, -0.0017392846789183846, 0.00093437308449627083,
+                        -0.00027367913217598834, 0.00044913602321363803, -0.00045377961080907505, 0.00022252393336447606,
+                        -1.0782206713941967e-07, -7.0869466203045202e-06, 3.6694286289691001e-05, -3.1068990233981328e-05,
+                        0.01283405563507394, 0.00098300104032273414, -0.0010702580760037507, 0.00055914806638956407,
+                        -0.00070487635403302881, 0.0011511221186948873, -0.0011464121498421717, 0.00055539325047159166,
+                        -0.0002091625111776567, 0.00030842018923089257, -0.00018515929797132498, 3.6175005546191001e-05,
+                        2.041986619673082e-06, -2.04258078602225e-05, 7.913250652213008e-05, -6.3725520514853351e-05,
+                        0.0016637276657512456, 0.00028219482763768456, -0.00026781880254740718, 0.00012373828871628702,
+                        -0.00020890627301364053, 0.00031801688202945312, -0.00022580999202306525, 6.8940707356994797e-05,
+                        -6.0226035676752272e-05, 6.8671486113732676e-05, 3.8380532787869807e-05, -6.519810110387486e-05,
+                        2.0384047449478232e-06, -1.4792420748182839e-05, 5.097713066730814e-05, -4.001120160725588e-05
+                    },
+                    {
+                        1.1049215799348215, -0.90254078034111251, 0.45653520866220287, -0.14168243778241413,
+                        -0.001161095495198759, 0.0041056964307832813, -0.010136697719226281, 0.0074183359153335527,
+                        -0.00035664797474920873, 0.0012313042445119377, -0.0029446507371659247, 0.0021322968635001669,
+                        -5.2226044381748776e-06, 1.2678535375492734e-07, 5.8775749023799126e-05, -5.7105226099955357e-05,
+                        0.13889783055713226, -0.1077364286974619, 0.040046418196817278, -0.0047915764606169973,
+                        -0.0027538711470516228, 0.009460987888455891, -0.022625064854561425, 0.016389973120369297,
+                        -0.00087400230948310074, 0.0028045172147232057, -0.0060932926707667088, 0.0042665656010661543,
+                        -2.5524627513766354e-05, -1.9198675222794928e-05, 0.00037556938426900461, -0.00035123622771619513,
+                        0.085219874590441391, -0.064742007753810588, 0.021122407078389173, -0.0005160677136561518,
+                        -0.0025358641466805745, 0.0079899489498698444, -0.017138038233594461, 0.01195106556808192,
+                        -0.00086610261787695977, 0.0022645272159992963, -0.0033539793697377799, 0.0019417113018386936,
+                        -4.791030970542406e-05, -7.9013591850335312e-05, 0.00089651879841210445, -0.0008157853383188125,
+                        0.01297377248512903, -0.008907061868131257, 0.00083004377001252535, 0.0015919516126090677,
+                        -0.00098307739491612688, 0.0027427658819060554, -0.0048283647749076232, 0.0030900981091689225,
+                        -0.00036344618326761171, 0.00071852066353510701, -0.00020495806319818365, -0.00020816360954226229,
+                        -2.8576326770548546e-05, -6.2870121115825241e-05, 0.00060490815364553112, -0.00054391276743089045
+                    },
+                    {
+                        0.27658845429084128, 0.15839080178757212, 0.064647031113567191, 0.020220035916964259,
+                        -0.00042252904716935099, 0.00049645227196305015, -0.00038244509875663327, 0.00017414357642698205,
+                        -0.0001267081312711124, 0.00014769675724118727, -0.00010857885825633708, 4.7032771995290373e-05,
+                        3.784364597543098e-09, -7.0142124317906769e-07, 3.7451859549236977e-06, -3.2011405950455464e-06,
+                        0.034539593550822666, 0.021108314671840316, 0.0075720919556616128, 0.0028851180437557255,
+                        -0.0009707799849172663, 0.0011224751998968566, -0.0008321519758088203, 0.0003615547669624259,
+                        -0.00028883594636170263, 0.00032430849737742585, -0.00020825526591994523, 7.5872098510918194e-05,
+                        1.3616932255111741e-06, -6.8506948457529472e-06, 2.2338641158420168e-05, -1.7505859059925432e-05,
+                        0.021165469525868681, 0.013232651103874145, 0.0045732179266935787, 0.0018089780774933519,
+                        -0.00081452398527768718, 0.00089350009739496349, -0.00057383354752407886, 0.00020154850630294717,
+                        -0.00023518548770365974, 0.00023085982072163633, -6.9874940265461386e-05, -1.6224109333475131e-05,
+                        5.4688056816053827e-06, -2.0283752388580823e-05, 5.0718463897133636e-05, -3.693208615226988e-05,
+                        0.003204492335404735, 0.0022118430091458753, 0.00064704069673224155, 0.00030144697016432938,
+                        -0.0002772461757086805, 0.00027822872988338945, -0.00012852660992781944, 1.4175116095222893e-05,
+                        -7.5991832320807434e-05, 5.6210666256829748e-05, 3.1456391436769823e-05, -4.7174922261783692e-05,
+                        4.3288579138852319e-06, -1.4818299631812838e-05, 3.3474987157902396e-05, -2.3524814519374427e-05
+                    },
+                    {
+                        -0.0012328788954772893, 0.0023523453478528291, -0.0025651401221088136, 0.0015012916962630542,
+                        -0.0014802483746846325, 0.0028172687796733003, -0.0030422763561118735, 0.0017702461372819604,
+                        -0.00044538846221509878, 0.00083802599224347125, -0.00086315221108556673, 0.00048756434147139132,
+                        -8.4901582743959799e-07, -3.9496708234435736e-06, 2.8715213118688636e-05, -2.534742928430234e-05,
+                        -0.0026201813739225926, 0.0049766280607617753, -0.0053372543304357938, 0.0030937052653039684,
+                        -0.003146300102302717, 0.0059342324661775638, -0.0061982410886530122, 0.0035360788294305228,
+                        -0.00094583667923292308, 0.001731422760487968, -0.0016007157210720583, 0.00084079579826184441,
+                        -7.4196075694642877e-07, -2.7020976913727239e-05, 0.0001392961075210603, -0.00011798155363336224,
+                        -0.0016872065588537462, 0.003145328032958136, -0.0031416200166290635, 0.0017425716787308977,
+                        -0.0020247140045591173, 0.0036804065127329995, -0.0033136844038118831, 0.0017080999759912523,
+                        -0.00060152772593608959, 0.00098220808526614098, -0.00046969011421296074, 8.1029492645292642e-05,
+                        5.8619252583696618e-06, -6.7490060382082329e-05, 0.00026094797566278454, -0.00021034313752621011,
+                        -0.00031120418145703357, 0.00054037674963141409, -0.00038204877706033959, 0.00015467640598917115,
+                        -0.00037208332121089078, 0.00058388223219200703, -0.00016098200686554781, -6.1996843735669189e-05,
+                        -0.00010463906946862666, 9.1361489835558652e-05, 0.0002789834708366139, -0.00028293717060872396,
+                        6.137543142766116e-06, -4.6402003618249201e-05, 0.00015566489357853505, -0.00012159167476333419
+                    }
+                },
+                {
+                    {
+                        0.26070050501353892, 2.5477075641658878e-05, -2.0995788098547774e-05, 1.0006370241764907e-05,
+                        -2.6417767866372023e-05, 3.0568820661130655e-05, -2.5185908308707979e-05, 1.2000948116290219e-05,
+                        -7.9237830221171911e-06, 9.1659107483239073e-06, -7.5440362207858829e-06, 3.5915721211842022e-06,
+                        8.4993373102144155e-10, -2.6117977776957851e-09, 6.5066633731044492e-09, -4.8374366989878924e-09,
+                        0.022322339883039423, 5.6993320657123969e-05, -4.6937327229910643e-05, 2.2357489260384942e-05,
+                        -5.9102120476909154e-05, 6.8359895746101818e-05, -5.6246439117309893e-05, 2.6771077053967195e-05,
+                        -1.7716980099998255e-05, 2.0466674426817555e-05, -1.6773163983870831e-05, 7.956860847129181e-06,
+                        7.5186396234381563e-09, -2.272676042648394e-08, 5.5430537598392834e-08, -4.0954176363202553e-08,
+                        0.013383686446885897, 4.4061117735187658e-05, -3.6200545693183354e-05, 1.7209051694173499e-05,
+                        -4.5703672308405866e-05, 5.2782311576576013e-05, -4.3219192963828368e-05, 2.0487361181614689e-05,
+                        -1.3672207233498005e-05, 1.5717683966623097e-05, -1.2682155806359871e-05, 5.9370657306840666e-06,
+                        2.1435399206697742e-08, -6.4337758420583542e-08, 1.554627816296894e-07, -1.145406739964453e-07,
+                        0.0018270705292755659, 1.3052265467881166e-05, -1.0673365180673259e-05, 5.0539123638186506e-06,
+                        -1.3545983577726945e-05, 1.5597129752296543e-05, -1.2648666973012547e-05, 5.9470774908244456e-06,
+                        -4.0357330595233426e-06, 4.5948633555500954e-06, -3.5908061350216081e-06, 1.6339394620416308e-06,
+                        1.5470565834517139e-08, -4.6324553855188504e-08, 1.1158159462236917e-07, -8.2130968916596507e-08
+                    },
+                    {
+                        0.27694083384856849, -0.15794897780427317, 0.064917332782858966, -0.020038229977551555,
+                        2.4685408135544244e-07, 3.2803062138336656e-05, -6.2216474372046773e-05, 4.0558515687519353e-05,
+                        7.8249603264850254e-08, 9.8363742917879528e-06, -1.8648234765493614e-05, 1.2153387183732216e-05,
+                        2.2993577496174458e-09, -2.5029000115758837e-09, 9.2944251788980802e-09, -7.8921519323558141e-09,
+                        0.035347519415335545, -0.020099964840758575, 0.0081724808932161497, -0.002483793606008386,
+                        -3.0428164928498197e-06, 7.7859756550671016e-05, -0.0001444591657897841, 9.383392801065669e-05,
+                        -8.9023697348126521e-07, 2.3312813777510886e-05, -4.314514586645516e-05, 2.7987385103196658e-05,
+                        1.2454397024726531e-08, -2.4834039685846473e-08, 1.0596360720713612e-07, -8.9555921396737993e-08,
+                        0.021839827996484901, -0.012403963127979169, 0.0050212730840068064, -0.0015163357138963033,
+                        -1.1636802109071456e-05, 7.1611717366568332e-05, -0.0001249864099248332, 8.0328009537398128e-05,
+                        -3.4438001710551993e-06, 2.1348957588833877e-05, -3.6893275071480622e-05, 2.3589541479667847e-05,
+                        2.6137246589868937e-08, -7.405652524635319e-08, 3.3045500191652033e-07, -2.7888057857866882e-07,
+                        0.0034323339116977998, -0.0019389532610390562, 0.00076953222351759394, -0.0002255730912405556,
+                        -8.724546401836906e-06, 2.7672865516534049e-05, -4.4518041546443358e-05, 2.8172077805094718e-05,
+                        -2.5874007054650392e-06, 8.2033066159403394e-06, -1.2907575346438776e-05, 8.0735955249093902e-06,
+                        1.6615245032161109e-08, -5.4237249297508637e-08, 2.4532316384261849e-07, -2.0694387534058909e-07
+                    },
+                    {
+                        1.1058724338907946, 0.90604987793379888, 0.46501242324640651, 0.14790828311152532,
+                        -1.4658670167850738e-05, 0.00010418024622618966, -3.0060981145849377e-05, -1.0681929205801209e-05,
+                        -4.3002944970155676e-06, 3.1120511930453175e-05, -1.0520096594330802e-05, -4.596730650162668e-06,
+                        4.1933752900897477e-08, -8.0439087272528742e-08, -7.249519162142175e-07, -6.6307041865304938e-07,
+                        0.14110475322504468, 0.11577698817954017, 0.059168401152821633, 0.018765646894316628,
+                        -6.7057648766398627e-05, 0.00016258653333238083, -0.00022675771672334114, -0.00013588880980667966,
+                        -2.0198162906850592e-05, 4.891038860814791e-05, -6.4593354050300765e-05, -3.7814794021115724e-05,
+                        -4.834673132348975e-08, 7.2186250301369044e-08, 1.9256128386647362e-06, 1.6605177547274525e-06,
+                        0.087135773475926215, 0.071438350550076066, 0.036215341914609081, 0.011351701426130288,
+                        -0.000138384373514386, -4.498702791625814e-05, -0.00054450046790718778, -0.00035976964615067449,
+                        -4.2839974499820256e-05, -1.1530297702157454e-05, -0.00013388972423174445, -8.1578006470990746e-05,
+                        -6.1725973643051514e-07, 1.1504247996679972e-06, 1.5244633314533959e-05, 1.3518621188120949e-05,
+                        0.013661317500832687, 0.011161140947131826, 0.0054559537309112113, 0.0016173454739222151,
+                        -8.9765003952653585e-05, -0.00010790547677383668, -0.00036193620907376534, -0.00024391660987924455,
+                        -2.8145169218477964e-05, -3.0570728026411163e-05, -8.2620712963634818e-05, -4.9874518306892486e-05,
+                        -5.5829989000526139e-07, 1.0586342511606611e-06, 1.3325362731416151e-05, 1.1846192576408224e-05
+                    },
+                    {
+                        0.0012324536613429486, 0.0023552725997201878, 0.0025833792280468256, 0.0015170614984563533,
+                        0.001479042292638895, 0.0028243909335120272, 0.003088572967928296, 0.0018104754993306155,
+                        0.00044390802547115309, 0.00084482907683879722, 0.00091102640091140369, 0.00052952745426322135,
+                        1.3775011220843904e-07, -1.3684947878488856e-06, -8.893641157250277e-06, -7.8217253243742589e-06,
+                        0.0026182239889296086, 0.0049964198699103774, 0.0054501810520130364, 0.0031902444892221021,
+                        0.0031418577265797123, 0.0059826460471408618, 0.0064705534276666265, 0.0037684203673779039,
+                        0.00094240194305976628, 0.0017779339308316641, 0.0018528701570927268, 0.0010548277632857683,
+                        -1.4887885400655727e-07, -9.304378109191744e-06, -4.7987975328595062e-05, -4.1055575921161563e-05,
+                        0.0016837835302885888, 0.0031944726399967074, 0.0034057503682749747, 0.0019664930252444993,
+                        0.0020194644884099465, 0.003801000194799271, 0.0039263555554166461, 0.0022231779699190064,
+                        0.00060316362075496803, 0.0010983960598896607, 0.00098481679993545545, 0.00050442651549405259,
+                        -2.0426683981447929e-06, -2.3169175898869239e-05, -0.00010028686800524306, -8.3572823838788251e-05,
+                        0.00030925312092487629, 0.00057409480798393435, 0.00055876748311245472, 0.00030394117351688083,
+                        0.00037007646655730554, 0.00066672301325862644, 0.00056380490046917036, 0.00027432717323455663,
+                        0.00010855649496849475, 0.00017125778896271091, 4.3875156128410455e-05, -2.2198247115153288e-05,
+                        -1.8618655283332268e-06, -1.591268134528968e-05, -6.360587841070012e-05, -5.2277306049631853e-05
+                    }
+                }
+            },
+            {
+                {
+                    {
+                        0.25523451546382686, 0.009003169283452463, -0.0088874764616280813, 0.0042500451943280147,
+                        -0.0066026464937112795, 0.010311837676030765, -0.0081576948014567031, 0.0029941585116852881,
+                        -0.0018699724260196164, 0.0023093091085477587, -1.5610284191007917e-05, -0.00094146510925719417,
+                        0.00012049822519328479, -0.00049303312856062605, 0.00095688036292762536, -0.00060261213604353666,
+                        0.010351575074760349, 0.018645507925697961, -0.015258053820901034, 0.0059715197976211573,
+                        -0.013980819970959256, 0.019713186798955364, -0.010018131231959418, 0.00082157093721480509,
+                        -0.0033274445685125913, 0.0026959803673506713, 0.0035199026967622825, -0.0040513688284710145,
+                        0.00059566319893302366, -0.0016651878074292633, 0.0018391692320665184, -0.00074400004848073373,
+                        0.0051409557255263621, 0.010497069566102114, -0.0032659752611423685, -0.0011926322388737672,
+                        -0.0080894672409294981, 0.0071124271885436973, 0.0041742749641584436, -0.0059138318539052005,
+                        -0.00032470476541078736, -0.0025281290005327362, 0.0042364619376785559, -0.0019758620747725637,
+                        0.00097995157822643392, -0.0015115811744981454, -0.0010190731241565588, 0.0017506529413449661,
+                        3.5461049371782946e-05, 0.00087057790988842902, 0.0031460271953345398, -0.0029393402660828957,
+                        -0.00070459321862489303, -0.0023969948586873512, 0.0060007322270522242, -0.0036168437099016798,
+                        0.001188970416501066, -0.0029894324784942067, 0.00046883356121092408, 0.0013990465526089652,
+                        0.00051563388470297141, -0.00031043460424713416, -0.002044426760797594, 0.0020024475249559534
+                    },
+                    {
+                        1.0888240252009289, -0.85135149298279367, 0.34824402450560338, -0.066714651129638355,
+                        -0.022288137421501535, 0.06445571772257104, -0.11520208929928206, 0.074019076399142347,
+                        -0.0078635182292566084, 0.016481294289897631, -0.0092728634672305417, -0.00030344584382735863,
+                        -0.00010519766629724388, -0.0022116252256439489, 0.010538785153066142, -0.0086681094758189782,
+                        0.099606601730837005, 0.0042945049127481654, -0.15986398355961429, 0.12392930939094793,
+                        -0.053479617394360052, 0.13331604767439356, -0.17484609780277466, 0.093041069281394301,
+                        -0.016446456386153833, 0.024863977102954828, 0.020058053901570814, -0.032147681099683176,
+                        0.0015459794220000656, -0.0088520968436186283, 0.022491259669194297, -0.015831124688257033,
+                        0.050266184220812381, 0.011701194320102686, -0.050539709107306631, 0.026460472918234688,
+                        -0.041019685507767099, 0.069402528540399425, -0.0025730894863869734, -0.032964393845790606,
+                        -0.0040398035008541141, -0.0083530658346781597, 0.045982267512541329, -0.036290032905893936,
+                        0.0055507977686261598, -0.011264650446174871, -0.0050708120814606716, 0.011909161519162784,
+                        0.00085629392138369259, 0.0071491169276412239, 0.021012564061676162, -0.025582104510098489,
+                        -0.0098835986101457694, 0.00022465443962845627, 0.057076185952305195, -0.051631644638378348,
+                        0.0049611885602497798, -0.017404137895066379, 0.014842099061661783, -0.0022431326585343153,
+                        0.0040635745419869739, -0.0046264191941275843, -0.018475401590856359, 0.020446497313670296
+                    },
+                    {
+                        0.27131540528578657, 0.16435285587900469, 0.061016049699170863, 0.021436698258128634,
+                        -0.0066823047753395374, 0.007198189738454046, -0.0032368058845387059, 0.00046686559435728952,
+                        -0.0018202993524068019, 0.0014593770345630119, 0.00047102845488655775, -0.00081255871946449125,
+                        0.00014416128634368568, -0.0004308292469175433, 0.00055238829565139758, -0.00026282166349100747,
+                        0.02284179514340276, 0.033359086666416966, 0.0020022638174384366, 0.003801179619941674,
+                        -0.014262640569814924, 0.013418124038471277, -0.002602565966232259, -0.0018517917181738654,
+                        -0.0031964569679403241, 0.001217536363501488, 0.0029662475038355488, -0.0025246168118650235,
+                        0.00064077341493539905, -0.0014028519416007434, 0.00095532792350997938, -0.00011080981155503867,
+                        0.012636378752771965, 0.019805948577539697, 0.0049421969571541643, -0.00026276152608090158,
+                        -0.0088248425526637076, 0.003881194742866557, 0.0044843659375751284, -0.003981468240179975,
+                        -0.00034709266237156582, -0.0027944116453538577, 0.0026565367402111469, -0.00043903709192892907,
+                        0.00098489647949162335, -0.0011508481084013783, -0.00095451981826205525, 0.0013664467162034762,
+                        0.0010264608704516588, 0.0024923222735528496, 0.003000358837628947, -0.0014866184800987139,
+                        -0.0012703306099663995, -0.0024453263985989905, 0.003840420391045585, -0.0015674298445240902,
+                        0.0010745808723584026, -0.002616623357677963, 1.0077213882639696e-05, 0.0014463950288227038,
+                        0.00049813984398997435, -0.00014844536792921886, -0.0014519706487359199, 0.0012756113920995736
+                    },
+                    {
+                        -0.019926037397312898, 0.036352225062076575, -0.032712618761686477, 0.016772498390832134,
+                        -0.023911719173193784, 0.041507608552201383, -0.029407792286690257, 0.011958500731820166,
+                        -0.0066928521443072996, 0.009284007675438714, 0.0004963123761670534, -0.00338058813633997,
+                        0.00047771672027352582, -0.001921435302910626, 0.0035653247710279545, -0.0022045618367030574,
+                        -0.041531386369491281, 0.071955198133323725, -0.052786693368597537, 0.022746274610090066,
+                        -0.04825634216856664, 0.076279904045121943, -0.032372224675752237, 0.0036286336127147266,
+                        -0.011343313989680921, 0.010784321323190642, 0.014463745036947062, -0.014790371957669378,
+                        0.0021616342844206233, -0.0062285123540947165, 0.0066997510875100664, -0.0026490514528691106,
+                        -0.023484222772132551, 0.033031584133513002, -0.0049290982664205903, -0.0052578212890067233,
+                        -0.022295049104266215, 0.021521785612165934, 0.019999909614707337, -0.020444685256624955,
+                        -1.9313776538295459e-06, -0.0088915222506252677, 0.014881290035033993, -0.006063253385733056,
+                        0.0031017712944664102, -0.0049407351585546832, -0.0038389058434423937, 0.0061021700834792926,
+                        -0.0018911717835739868, -0.0027153614920206594, 0.015317600538980729, -0.011242517672043399,
+                        0.0022483456586764069, -0.013755753984059538, 0.02263232480628254, -0.01142150955538635,
+                        0.0048503201338918568, -0.010581299783646638, -0.00010415615588149003, 0.0064170985309502738,
+                        0.0014306185601314196, -0.00048716753256192473, -0.0074836163985808109, 0.0069131999266230431
+                    }
+                },
+                {
+                    {
+                        0.26037049739658891, 0.00040691259678926985, -0.0003340890231574796, 0.00015872082002151757,
+                        -0.00042213052494248705, 0.00048731506023597982, -0.00039826539547136618, 0.0001884585271805675,
+                        -0.00012626357057070453, 0.00014488418091439947, -0.00011575041165329104, 5.3666685867097075e-05,
+                        2.0362077655683186e-07, -7.4315196007742151e-07, 2.1977184112344656e-06, -1.7069511592144674e-06,
+                        0.021585487441060199, 0.00090568781604461238, -0.0007358989530510861, 0.00034657270056708906,
+                        -0.00094060668818028107, 0.0010786415904525278, -0.00086333121718075391, 0.00040134425083109085,
+                        -0.00027865073076248841, 0.00031309510363387031, -0.00023397711370630158, 0.00010204510266370336,
+                        1.9522663021840771e-06, -5.7621244723273224e-06, 1.3595847340578858e-05, -9.9431815203388918e-06,
+                        0.012817908312525496, 0.00068749111212743096, -0.00053762546910387024, 0.00024485714366050696,
+                        -0.00071677219727781633, 0.00080224448478040443, -0.00059320671888482741, 0.00025622487086898819,
+                        -0.00020471697664585265, 0.00021206742940962816, -0.00011619052800330466, 3.2974545582052443e-05,
+                        5.7438940657028766e-06, -1.5446631416706295e-05, 3.1749143029594899e-05, -2.2166217141997346e-05,
+                        0.0016617359104090625, 0.0001962649265119605, -0.00014111546500167546, 5.9171359741281719e-05,
+                        -0.00020624319630174967, 0.00021924423307434005, -0.000132901190392561, 4.4797594320522664e-05,
+                        -5.4369323122076466e-05, 4.5447342977170469e-05, 2.4040067999146414e-06, -1.6202518428533987e-05,
+                        4.1881183624809403e-06, -1.0910904034412364e-05, 2.1223299568832953e-05, -1.4507870640037558e-05
+                    },
+                    {
+                        0.2769444944041215, -0.15753958100062551, 0.064142144010725169, -0.019533401771209012,
+                        5.4120923352776448e-06, 0.00052316411111918623, -0.00098848147276715402, 0.00064292446905102525,
+                        2.5610258253745788e-06, 0.00015574118173485276, -0.00029072174337022532, 0.00018778386915601971,
+                        4.8909753646911529e-07, -6.7670291441710698e-07, 3.5168222128559984e-06, -3.0975517989938412e-06,
+                        0.035312681011507668, -0.019133067605326733, 0.0063937536056815824, -0.0013336901275680885,
+                        -4.0295346327473047e-05, 0.0012291890168278394, -0.0022412263142894632, 0.0014421447393858492,
+                        -6.104750488687349e-06, 0.00035717883887296712, -0.00062426685405763186, 0.00039214002267912303,
+                        3.3388763936041172e-06, -6.380468377773309e-06, 2.6196390912699747e-05, -2.2021483171379217e-05,
+                        0.0217012397752652, -0.011527735129217925, 0.0035415941013215578, -0.00058177220112347382,
+                        -0.00016766669900548497, 0.0010965514443581057, -0.0017900173461134594, 0.0011094177292772058,
+                        -3.5979243881751893e-05, 0.00029489558232944512, -0.00040413086429489769, 0.00022297184754995207,
+                        8.3468604081499579e-06, -1.8654309942936694e-05, 6.8681017722917238e-05, -5.6231075168703521e-05,
+                        0.0033276987571828611, -0.001606893881471752, 0.0002740625678480502, 7.5317699541912241e-05,
+                        -0.00012751927013942486, 0.00040674624346858675, -0.00055853810900024147, 0.00032216764331562158,
+                        -2.8576957697062643e-05, 9.7179417745831551e-05, -7.2709818919012149e-05, 1.8739763842711479e-05,
+                        5.7430332517998959e-06, -1.3574166755394079e-05, 4.8108265680969609e-05, -3.8992113185129775e-05
+                    },
+                    {
+                        1.1056892007591015, 0.90732777702823175, 0.46455539079145169, 0.1477084157896999,
+                        -0.00024289745288348947, 0.0016079592689986696, -0.00057988554549342727, -0.00023848733700921815,
+                        -8.5228195435783623e-05, 0.00045909305719040404, -9.400412264775857e-05, 1.1272653572895365e-05,
+                        -6.6134999436798479e-06, -5.6498018954847979e-06, 7.2505032604282065e-05, 6.7564107274629669e-05,
+                        0.14025435285773591, 0.11783089572801388, 0.056836616994707961, 0.017499533583924868,
+                        -0.0010939134528239168, 0.0026701234713849536, -0.002385971311605796, -0.0011210899271563584,
+                        -0.00031437058640901598, 0.00087658805913956562, -5.1809140488804487e-05, 0.00018447535107495944,
+                        1.7599760242776574e-05, 5.0413358664994501e-05, 0.00029085646191573091, 0.0002087987051725623,
+                        0.085365125021151164, 0.071222838583875847, 0.032216210606063021, 0.0092211653786076139,
+                        -0.0021897252711009551, 0.00018149564313983484, -0.0028748265171942922, -0.0010078456873550245,
+                        -0.00046267851437554672, 0.00059318253375462713, 0.00083604050219810409, 0.00080060788874891002,
+                        0.00014228113118955218, 0.00025177299722138505, 0.00034668416087669639, 7.7439783223858492e-05,
+                        0.012509315550691012, 0.010131563071228316, 0.0032781668952036238, 0.00053912913139944824,
+                        -0.0013958105949649882, -0.00090619558075187004, -0.0010535604201359653, -8.2473660059063716e-05,
+                        -0.00024034483351289122, 0.00019320902704546964, 0.00084585775301958754, 0.00066395990440853471,
+                        0.00012499780635184801, 0.00020628967647426136, 0.0001264321334756285, -7.5124460878080404e-05
+                    },
+                    {
+                        0.019767820179118923, 0.037281097297713707, 0.038657814209126382, 0.021917735636160736,
+                        0.023746812200995726, 0.044109433777289299, 0.042869183186154215, 0.023269305833477309,
+                        0.0070521957941013192, 0.01228149316681428, 0.0088564817028731549, 0.0036842465742607231,
+                        -8.8188510063407435e-05, -0.00058552706434194428, -0.0019393085888234508, -0.0015167634543737892,
+                        0.041737007980850442, 0.07734402986213805, 0.075137621993161971, 0.040880512647574106,
+                        0.049619248974138545, 0.089348773239956714, 0.077027344348323423, 0.038366768718981391,
+                        0.013946104657212145, 0.022418683377854055, 0.010331436919683114, 0.0017055601266017816,
+                        -0.00066111714331894365, -0.0023732756916272205, -0.0052462191263796384, -0.0036940268170857142,
+                        0.025831375080831304, 0.044886152100090199, 0.03374057613452143, 0.015002599972255101,
+                        0.028950938920451051, 0.046546116343046888, 0.023633985148138446, 0.0058774968436983823,
+                        0.00586492853940704, 0.0063560805291143184, -0.0044093458082864016, -0.0051809642618814763,
+                        -0.0015831438607808357, -0.0033699278280945317, -0.0023196828362183658, -0.00048521812106301637,
+                        0.0039901799818634212, 0.0049803777658139784, -0.002779188511084418, -0.004033930784571791,
+                        0.0031500863355547197, 0.0013185154467843655, -0.010650327986010146, -0.0092861695335177546,
+                        -0.0010979210644769613, -0.0039069121625979327, -0.0057508040284611527, -0.0029957257275027458,
+                        -0.0010508677622565158, -0.0016096035415284686, 0.001176402343117215, 0.0018793195282233821
+                    }
+                }
+            }
+        },
+        {
+            {
+                {
+                    {
+                        0.32940350073665164, 0.0061847342799738756, -0.0066372475843252451, 0.0034291465367832334,
+                        -0.004446314198748082, 0.0072026815935092251, -0.0069913289621731838, 0.003310562482492954,
+                        -0.0013019811186460088, 0.0018790059571654086, -0.0010457511084701768, 0.00015267522589937647,
+                        2.5325528711405933e-05, -0.00015488482235844403, 0.0004909518062014256, -0.00037761863800484804,
+                        0.039749758325477641, 0.004094500668470182, -0.004044788903126104, 0.0019465934035972289,
+                        -0.0029940232997697838, 0.0046412629849586417, -0.0037645174201663247, 0.0014529306183798743,
+                        -0.00084035343748901025, 0.0010470633908748876, -4.733824150187522e-05, -0.00039410689833868661,
+                        4.322387525190998e-05, -0.00018744892003342938, 0.00045709556068849219, -0.00032452146934331858,
+                        0.0080441476978006382, 0.0013926162744544817, -0.0011598111421927608, 0.00046395029492037618,
+                        -0.0010443801927616822, 0.0014868443340897526, -0.00077926171478764873, 7.9903334713667234e-05,
+                        -0.00025822446000011828, 0.00022135878066897386, 0.00028391036859642547, -0.00033628726912169113,
+                        3.8305164101028e-05, -0.0001175971773050471, 0.00017002392355993951, -9.1210709419543796e-05,
+                        0.001142188262775594, 0.00033587705605835874, -0.00022669226131120769, 6.383994315262216e-05,
+                        -0.00025683985063437172, 0.00033202574117930956, -7.3981108412369924e-05, -7.0403937517413498e-05,
+                        -5.1663105714765118e-05, 1.6722682822478864e-05, 0.00011617301062083388, -0.00010340377757982438,
+                        1.6791005911435243e-05, -4.1550198226366487e-05, 2.7514237557405701e-05, -1.0106382413565672e-06
+                    },
+                    {
+                        1.5660556239136503, -1.2506700480940374, 0.56618415972353475, -0.14147611318457654,
+                        -0.016479546950436821, 0.050849366188295025, -0.1059469927117327, 0.073074395785364066,
+                        -0.0055851590708501583, 0.014071969647157005, -0.019216581341202948, 0.010536953189153105,
+                        -0.00024214349285919489, -0.00071123340322538323, 0.0059289241057592073, -0.0052669251959114984,
+                        0.27462985391293071, -0.20167729370470822, 0.052553698905637589, 0.0086261041423963628,
+                        -0.013020643114650277, 0.036858814105289982, -0.066916184708163462, 0.043510471783113319,
+                        -0.0044678472908026793, 0.0093721882528094592, -0.0061487081090232185, 0.00069065519050878548,
+                        -0.00013112535130852643, -0.0010115771306406659, 0.006027014503030192, -0.0051589934437436882,
+                        0.060647568489280795, -0.040764645793902127, 0.0039334699732805796, 0.0067540790588066701,
+                        -0.005650716070113671, 0.014073939703957816, -0.019538969506245868, 0.010883519555857601,
+                        -0.0018281041929542187, 0.0028812337436717318, 0.00169049760249743, -0.0031521745833143809,
+                        7.679861995683361e-05, -0.00078484415952199168, 0.0026821662611997352, -0.0020714821288376072,
+                        0.0095716004985518261, -0.0054936319564773848, -0.00099008196952105271, 0.0019775025343194133,
+                        -0.0016423695476710206, 0.0036613384559146638, -0.0036336068050418949, 0.0014577529202003578,
+                        -0.00046876428218703393, 0.00052701682436381749, 0.0012282750566033507, -0.0014257574153277016,
+                        7.6875848387943704e-05, -0.00032484624879989426, 0.0006117479001795438, -0.00037516234914473023
+                    },
+                    {
+                        0.39109574854524592, 0.23047036392812359, 0.089339199328485053, 0.030027612622924131,
+                        -0.0051966128715959662, 0.0056239529149430126, -0.003470137890475311, 0.001142914565769988,
+                        -0.0014778075219989396, 0.0013966169263535839, -0.00034060212024352566, -0.00016125362396706878,
+                        4.8863866601660179e-05, -0.00015659284712729569, 0.00032357854424986949, -0.00021970108562980806,
+                        0.068122542680637069, 0.044134647874120678, 0.014513156874798386, 0.0059277341403208735,
+                        -0.0037743733484446765, 0.0038357323105715243, -0.0019008817976645085, 0.00034674560853683136,
+                        -0.0010172673312389389, 0.00078536288360823222, 0.00018024236521836049, -0.00040471778484332523,
+                        6.9281577891298782e-05, -0.00019341257123646946, 0.00031195541234243991, -0.00018723159034853833,
+                        0.015014242392505718, 0.01057076037237697, 0.0031356297714210573, 0.0013286918672128689,
+                        -0.0014639952565479225, 0.0013252135348866012, -0.00036293180282267454, -0.00014125870129351312,
+                        -0.00034771378668155923, 0.00014998128391856245, 0.00027311414243258024, -0.0002661897487590713,
+                        5.4013360832463585e-05, -0.00012550301399838921, 0.00012137801827216221, -4.4390316062216526e-05,
+                        0.0023690741594402254, 0.0018803187069400614, 0.00049902305136530721, 0.00020098162804062778,
+                        -0.0003911372013012715, 0.00031146481187428428, -8.8466252275996073e-06, -9.7851821403381384e-05,
+                        -7.8237578035494039e-05, -1.0422636406385862e-06, 0.00010606173891478537, -7.9542525314416307e-05,
+                        2.2543477791854906e-05, -4.5721941156740647e-05, 2.0516212524862426e-05, 6.2069480913150927e-06
+                    },
+                    {
+                        -0.010446589931391843, 0.019426998121909143, -0.019249723729753809, 0.010626571324305362,
+                        -0.012513030089877837, 0.022654828744537753, -0.020170642554113938, 0.010327547133021165,
+                        -0.0036698905936415008, 0.0059499720949433635, -0.0028903227520895025, 0.0005680384437695518,
+                        6.9866304672627254e-05, -0.00046538815176706448, 0.0014738076642597856, -0.0011353723723281158,
+                        -0.0057462467946901409, 0.010401405639917372, -0.0092373748944871124, 0.0047178904308393683,
+                        -0.0068383871898578226, 0.011751764320315468, -0.0081893162928621775, 0.0033152047921147388,
+                        -0.0019040255633763492, 0.0025996228951579176, 0.0003877071922662326, -0.001180104476368557,
+                        0.00011268190167139612, -0.00050241703582105035, 0.0011841014858415451, -0.00083242068311966582,
+                        -0.0014103317466890044, 0.0023892470693423849, -0.0015352781997721931, 0.00055778208137543096,
+                        -0.001631278632817924, 0.0024577836390694986, -0.00054100025564220232, -0.0003343307258551597,
+                        -0.00036561747900629149, 0.00024144255098754023, 0.00088098719531106969, -0.00080194559595410375,
+                        8.6505715972782688e-05, -0.00025792539948787637, 0.00030680350182245574, -0.00013767666139912128,
+                        -0.00024722615430714542, 0.00037931389073777785, -0.00010771622682796794, -3.0764607700293982e-05,
+                        -0.00026787057992888922, 0.00032215098387632904, 0.00019575917229693331, -0.00026845667501035147,
+                        -2.9742165728011969e-05, -5.4605528666630543e-05, 0.0002429941093402191, -0.00016582015087128073,
+                        3.3007737245300186e-05, -7.3754440665113515e-05, 4.5918917039204767e-06, 4.0196477390889758e-05
+                    }
+                },
+                {
+                    {
+                        0.33287685697131236, 0.00027852243732033724, -0.00022867713809124993, 0.00010864671915910072,
+                        -0.0002889274001173413, 0.00033353098147927271, -0.00027272414023190591, 0.00012913057064204114,
+                        -8.6379967923344442e-05, 9.9165511548559443e-05, -7.9662080615273121e-05, 3.7152317373291723e-05,
+                        1.6449088439999293e-07, -4.9109711040809385e-07, 1.178250986893813e-06, -8.662310391161476e-07,
+                        0.042101634297383977, 0.00018857296824682031, -0.0001543170267290394, 7.3115669521733471e-05,
+                        -0.00019568919149138517, 0.00022542548680149063, -0.00018309639334733064, 8.6203129017911373e-05,
+                        -5.8335902848743971e-05, 6.6521755695947166e-05, -5.2279855946078046e-05, 2.3914331738448088e-05,
+                        2.0471482056563748e-07, -6.070807574609071e-07, 1.4432935269450557e-06, -1.058126967649267e-06,
+                        0.0088791625002846673, 6.7247528629879862e-05, -5.4668622858399046e-05, 2.5757723374643186e-05,
+                        -6.9835901403629891e-05, 8.010973188568563e-05, -6.4192275853661363e-05, 2.9872380641119903e-05,
+                        -2.0696305116863192e-05, 2.3281175793921249e-05, -1.7479691776087477e-05, 7.6602865398886635e-06,
+                        1.4069325399585766e-07, -4.1192577184912747e-07, 9.6222166598243964e-07, -7.0158173800136353e-07,
+                        0.0013530747119079047, 1.7152874153805485e-05, -1.3842095444596464e-05, 6.4809429182117609e-06,
+                        -1.7827238335739434e-05, 2.0354497450471374e-05, -1.6064208712938754e-05, 7.3761670237268247e-06,
+                        -5.2483426685344452e-06, 5.8138784321334094e-06, -4.1354390870105391e-06, 1.714108103419436e-06,
+                        5.5271221550188372e-08, -1.5999896380751791e-07, 3.6779145156196709e-07, -2.6680251762322424e-07
+                    },
+                    {
+                        0.39540277405697277, -0.22520380191727601, 0.092105172131933963, -0.028231830379769698,
+                        -8.3465667573162617e-05, 0.00046371123799091908, -0.00080155016436899047, 0.00051414108065012359,
+                        -2.4745902008688913e-05, 0.00013804601124790494, -0.00023559520177609779, 0.00015013529056469277,
+                        1.6331226017328832e-07, -5.8730389780639604e-07, 2.6636964567272213e-06, -2.2444924481685545e-06,
+                        0.071250612883241804, -0.040386377798160809, 0.016231029972663603, -0.0048494263844212739,
+                        -9.8838283890807012e-05, 0.00036428993383035832, -0.00059911602955359201, 0.00038053309180864398,
+                        -2.937161173318115e-05, 0.00010790550617214201, -0.00017334280345135321, 0.00010877805328547374,
+                        1.5693249430955207e-07, -7.5988155296542964e-07, 3.4854836954488518e-06, -2.9308326721681825e-06,
+                        0.016238362013146077, -0.0091592915703229902, 0.0036154340798354059, -0.001051073093820613,
+                        -5.8778848840546733e-05, 0.00015713519843194872, -0.00024290235324916961, 0.00015214146579103051,
+                        -1.7510866423661969e-05, 4.6125924237047663e-05, -6.815234880592599e-05, 4.1683518807787936e-05,
+                        7.0747429503079985e-08, -5.5768272454484821e-07, 2.5576793741727456e-06, -2.1413593753367456e-06,
+                        0.0027017364693067815, -0.0015123210701732069, 0.00058006977448966707, -0.00016103407307484723,
+                        -2.0013243772212244e-05, 4.5710360591833554e-05, -6.7646585248643719e-05, 4.1889132247471483e-05,
+                        -5.9723298043690934e-06, 1.3292855042681441e-05, -1.8347458221558413e-05, 1.0938506742898019e-05,
+                        1.9074549898265162e-08, -2.3083356408882302e-07, 1.0498352655320968e-06, -8.7559104717269218e-07
+                    },
+                    {
+                        1.5784259067928845, 1.2933954514036701, 0.66097072007058655, 0.209159038626549,
+                        -0.00095184125382169883, -0.00037249746047647732, -0.0034735116176305564, -0.0022526644578302608,
+                        -0.00029772602033335647, -8.8519820818548599e-05, -0.00075585495987821297, -0.00042110995875363922,
+                        -4.9009774551466928e-06, 1.3807020476208276e-05, 0.00014159010193365735, 0.00012405645759927433,
+                        0.28401813305632301, 0.23259331225814309, 0.11656902529708128, 0.035952408292084556,
+                        -0.001015950377700366, -0.00088496042728689593, -0.0034717186212130271, -0.002230498696090604,
+                        -0.00032087832493353887, -0.00022528181876565123, -0.00062260347744853037, -0.00029943793860174917,
+                        -5.2375842948024464e-06, 2.3995223523278252e-05, 0.00019774761562456794, 0.0001704413418289023,
+                        0.06458563963424184, 0.052761698333056911, 0.025769572806737754, 0.0076636028718266016,
+                        -0.00055814120545951654, -0.00059637361553193833, -0.001585367440478473, -0.00096529843125306674,
+                        -0.00017579993951640923, -0.00013967251703209818, -0.00016434477535918023, -2.1119078847040251e-05,
+                        -5.6724552083910239e-07, 2.3256387684545988e-05, 0.00013305847469799982, 0.00010961089837224764,
+                        0.010708319278811065, 0.0087202339868617251, 0.0041157069446489513, 0.0011674710260357244,
+                        -0.00018148784916205001, -0.00019393670462009165, -0.00040869100100786814, -0.00022631702788325608,
+                        -5.6184765496799984e-05, -3.9380501130600821e-05, -1.942228722119128e-06, 3.3602625872728895e-05,
+                        1.0913268184889859e-06, 1.1037129456296238e-05, 4.6360138597637473e-05, 3.5996775730620038e-05
+                    },
+                    {
+                        0.010430241676612403, 0.019771616112983021, 0.021015294513967567, 0.012112759895602385,
+                        0.012503711838116358, 0.023499706415306961, 0.024154339239672872, 0.013636908503502273,
+                        0.0037223384976526482, 0.0067576503800736579, 0.0060144148430342128, 0.003068935087852749,
+                        -2.1341960186567738e-05, -0.00016125818272161557, -0.00061755150777084429, -0.00050365777507230573,
+                        0.0057391044873379409, 0.010786177791759168, 0.011083178204581904, 0.0062555142541094689,
+                        0.0068658578471129297, 0.012692101046357724, 0.012198968928509534, 0.0065873864344554514,
+                        0.0020143889937702581, 0.0034847259087363363, 0.0024514159202647283, 0.00099500340806863612,
+                        -3.2872586441941916e-05, -0.00017729291565154169, -0.00057391644847811668, -0.00045199822084723243,
+                        0.0014179198333770008, 0.0026096769883729031, 0.0024612630508930272, 0.0013112017107103238,
+                        0.0016826225970501703, 0.0029894137228103027, 0.0024093005854552534, 0.001129613771941939,
+                        0.00046753549359677374, 0.00071772982753190505, 0.00018550664430887448, -7.6849230744299192e-05,
+                        -2.5980502758490664e-05, -9.6600948844644189e-05, -0.00022537710984675243, -0.0001619712919299628,
+                        0.00025364226138092298, 0.00045307834322050756, 0.00037408523841189257, 0.00017919084984639448,
+                        0.00029591339895252637, 0.00049678728367979683, 0.00029433421643372461, 9.2797875954063e-05,
+                        7.3167331613712224e-05, 9.1585870213324507e-05, -4.4734919729588945e-05, -6.7593230748952499e-05,
+                        -1.0533756236357053e-05, -3.0201792712979325e-05, -4.5163314901762653e-05, -2.6298579282804472e-05
+                    }
+                }
+            },
+            {
+                {
+                    {
+                        0.28309785208838001, 0.063675574874566571, -0.029343888450593561, 0.0022530271124624182,
+                        -0.047673794496328609, 0.044774741034703809, 0.0011452322471827165, -0.01383577364486074,
+                        -0.0028970527075720277, -0.0088266063209725149, 0.01225444132698684, -0.003825469602689726,
+                        0.0040726823620426227, -0.004607386735664314, -0.004398223384972021, 0.0057815730154158421,
+                        0.014206145248925569, 0.028317439548379519, -0.0034035443193314251, -0.0056898408323321206,
+                        -0.020766732610122397, 0.0071106655533581063, 0.012161955224393199, -0.0076691699496841403,
+                        0.0030145489031129708, -0.011109549491167835, 0.0030102141310163, 0.0039224857392818249,
+                        0.0018213624202231863, 0.00098235131746575921, -0.0050324083971647494, 0.0027906202380665059,
+                        0.0021051850748495314, 0.0038692417495414166, 0.0018988877013069653, -0.0017083163969137494,
+                        -0.0025541234839002291, -0.0040163163860349026, 0.0024556124037952392, 0.0017125792569047448,
+                        0.0019227576132594777, -0.0026951532318572951, -0.0016795111402514999, 0.0023927318873144584,
+                        -0.00029361165891099699, 0.0023283196841243593, -0.00052295737567130852, -0.0014151355643038171,
+                        0.00021116457355266775, 0.00020835870603492823, 0.00025903194267086038, 8.4105433964847058e-05,
+                        -0.00011107712256937519, -0.0009660158212945651, -0.00033636305066428332, 0.00093813109466693199,
+                        0.00031373455923346409, 9.9596787493769575e-05, -0.00043656530117879564, 3.1874970653089433e-05,
+                        -0.00022487743136357266, 0.00060644650746170142, 0.00036901860680555603, -0.00072964707574244155
+                    },
+                    {
+                        1.3602104125476777, -0.79337108028692926, 0.0570605368027301, 0.10079497746413921,
+                        -0.22496641598955128, 0.40511382086581799, -0.22902418846033737, 0.017968291653858506,
+                        -0.017324682655954497, -0.030582165585582029, 0.1375195078774559, -0.099532973290888449,
+                        0.023649151527079651, -0.040052331267294849, -0.028119792941113528, 0.049193534974062515,
+                        0.13930198587728473, 0.045899634347298851, -0.1003519068183551, 0.030758755891449028,
+                        -0.11653462487699734, 0.14188981148981542, 0.033591312377809227, -0.083031919439762666,
+                        0.01554173800055552, -0.069527827802704514, 0.068635921481828899, -0.01674446113510206,
+                        0.013072319914038722, -0.0055880742825441445, -0.050875347025179901, 0.047018574343505933,
+                        0.021028655069459719, 0.012479217807916783, 0.0019101326096427134, -0.012766682455603846,
+                        -0.019376656858455136, -0.0010286429532706768, 0.024753857038955773, -0.010886238464912429,
+                        0.012301375123094389, -0.026352541128265291, -0.0022200888682215383, 0.017209737527015004,
+                        -0.001310896369494993, 0.013044526813037175, -0.011682060698713918, 4.3764152079827962e-05,
+                        0.0021795437724901443, 0.0013804503155267879, 0.00081008479194992716, -0.0011390376449315932,
+                        -0.0013103942366619224, -0.0045912356157774377, -0.00071019164973973867, 0.0054997352882234628,
+                        0.0025007328190886731, -0.0026212748584667073, -0.003131062229679302, 0.0034261778881585683,
+                        -0.0016757585837088554, 0.0049975627280230261, 0.0018692839058622726, -0.0054639200156697612
+                    },
+                    {
+                        0.33892751851639857, 0.26956814325515543, 0.086514382132940104, 0.022979233687963153,
+                        -0.052932233989403568, 0.02401832260559246, 0.012775048723603303, -0.011131165197536361,
+                        -0.0028767327001466428, -0.011550074631986517, 0.0079194254781181327, 0.0010088993064447185,
+                        0.0043757778634425266, -0.002909354508507002, -0.0043835733973437594, 0.0042268254022798553,
+                        0.036562616306244911, 0.058972654598805456, 0.021047020818476533, -0.00073540933075884785,
+                        -0.026117154427582608, -0.0028025934074184483, 0.012716543333712712, -0.0025410734800281032,
+                        0.0031814832010207609, -0.011563894550054955, 0.00042366769308207315, 0.005285938453656101,
+                        0.002242561388448909, 0.0021115580980346268, -0.0041976665278595877, 0.00098685418346944245,
+                        0.00615146459969961, 0.010645228763924965, 0.0066027294298378137, 0.00020335863697530795,
+                        -0.0048069184794583665, -0.0065288412269161348, 0.0019119162475199928, 0.0028730819965034978,
+                        0.0023142015403164744, -0.0026313325735972627, -0.002090738716424876, 0.0019793800219194877,
+                        -9.3436150323342605e-05, 0.0027343352191911618, -0.00036139237294358821, -0.0017888843008923682,
+                        0.00064698264256975093, 0.0011588159504282718, 0.0010796665725774169, 0.00038481454396283509,
+                        -0.00056634522301207051, -0.0016298892167070074, -0.00039577978198976148, 0.00099235392253000602,
+                        0.00051648627559690145, 0.00013016603368926316, -0.00055968656279032866, -8.5773741257154487e-05,
+                        -0.00021125405437461272, 0.00074654105760993677, 0.00035312630775546699, -0.00073189684509557588
+                    },
+                    {
+                        -0.14043374462110991, 0.20471024884437936, -0.077281873764098133, 0.011603064494032336,
+                        -0.13305276702842847, 0.15012984794071332, 0.016229048743813652, -0.036081446991549269,
+                        -0.0071751226158020751, -0.022799373298197156, 0.040313822843160582, -0.010112051389708061,
+                        0.011646629092111744, -0.014515220834908612, -0.013410393935590785, 0.017290928322046276,
+                        -0.060574652367892126, 0.067992513192048298, 0.0068463478308381813, -0.01545862069913928,
+                        -0.040109057206123386, 0.012109648746115052, 0.042951935293477392, -0.01504747587669448,
+                        0.010249911462950565, -0.028943927794392393, 0.005957312920177941, 0.013940142034548977,
+                        0.0035970986748337383, 0.003959072645733858, -0.013807543880047844, 0.0062081792674353016,
+                        -0.0069493673744150932, 0.00031810682025074902, 0.0091234865097700162, -0.0024612431956030074,
+                        0.0021716640635766329, -0.014360109865230725, 0.0042705177315817619, 0.0086919509276511871,
+                        0.0043665945097251975, -0.0038074917395974502, -0.0062526901365511254, 0.0058827274688886266,
+                        -0.0016254183160302788, 0.0062222664861451074, 0.00010456137940282062, -0.0051944465581089099,
+                        -1.6673472237966462e-05, -0.0013910636581281396, 0.000326708457382273, 0.0011738231432527697,
+                        0.0011745732026478219, -0.0014421620818688087, -0.0021195092732148764, 0.0024720244454335362,
+                        7.6124323468558096e-05, 0.0015253270056530461, -0.00080452180016865886, -0.00093220791709650746,
+                        -0.00059043111417790225, 0.00087649291513372963, 0.0013737807639961025, -0.0017484980918763536
+                    }
+                },
+                {
+                    {
+                        0.32930779668388932, 0.0043233559396587858, -0.0033482312260384624, 0.0015119066649788755,
+                        -0.0045109486985754083, 0.00501692858060714, -0.0036427109794771478, 0.0015463057341649983,
+                        -0.001273355329794542, 0.001293336520065604, -0.00066728855341854334, 0.00016919953926017368,
+                        4.4546947940835816e-05, -0.00011275857798324171, 0.00020897711151281401, -0.00014013651070494455,
+                        0.039708734942598002, 0.0028535338382625918, -0.0020958088037460656, 0.00089976693189795147,
+                        -0.0029908671905877521, 0.0032167569973412862, -0.0020827613270655572, 0.00077644516009545454,
+                        -0.00079723228625810461, 0.00071372078423544713, -0.00016393690729714399, -7.4900874329340933e-05,
+                        5.5627713445331053e-05, -0.00013129112528297406, 0.00021196126520057224, -0.00013344856733520284,
+                        0.0080431147420126376, 0.00096601213104337779, -0.00063519350089192683, 0.00024147061578093753,
+                        -0.0010203292550688844, 0.0010237622228262573, -0.0005058081551205521, 0.00011625262580030613,
+                        -0.00023792371990615909, 0.00015015195479044932, 9.0898647540147543e-05, -0.00011471529996944527,
+                        3.7421287789385638e-05, -7.8663042933079051e-05, 9.5811899705442575e-05, -5.0649865988889568e-05,
+                        0.0011448346969491524, 0.00023213313295697955, -0.00013321287678989347, 4.1763524463725107e-05,
+                        -0.00024695786470113731, 0.00022782790919731943, -7.2267302689776284e-05, -6.8508859959704855e-06,
+                        -4.7750621221408646e-05, 1.2082154036831232e-05, 5.0989597440530773e-05, -4.2250332761883969e-05,
+                        1.4220079099379495e-05, -2.6951053295279685e-05, 2.2873590330146836e-05, -8.0644380946800765e-06
+                    },
+                    {
+                        0.3944035129041264, -0.21955728125566634, 0.08274218314809284, -0.022355243410285455,
+                        -0.0012140126912416212, 0.0070305726622123402, -0.011185106102077907, 0.0068598543105926665,
+                        -0.00026480848400873511, 0.0018435049003926441, -0.0023756298310361112, 0.0012596335278799416,
+                        5.9477888505249673e-05, -0.00014423933659069886, 0.00048578622848290728, -0.00038892888844080023,
+                        0.070059479111685807, -0.03602632310414898, 0.0095849312812762415, -0.00079575030234158928,
+                        -0.0014552210073969433, 0.0053288603487613561, -0.0075191052568670562, 0.0043790971574821343,
+                        -0.00032590294772333556, 0.0012636586066620055, -0.0011053229075024768, 0.000394382747931333,
+                        6.8056778890362716e-05, -0.00017951724514266254, 0.00053937777568666449, -0.00041838999792387973,
+                        0.015526382520988286, -0.0073365429225316558, 0.0011751803744012271, 0.00035863810431025514,
+                        -0.00087193588004878093, 0.0021529787294895016, -0.0024718076679291273, 0.0012815399703499633,
+                        -0.00019612551709789246, 0.0004144993297880431, -5.1293414110655406e-05, -0.00014549613153487311,
+                        4.1184543273315736e-05, -0.00012005346375790324, 0.00028702731692822984, -0.00020639480419505993,
+                        0.0024588956403643618, -0.00099924316766037465, -2.8720795245120768e-05, 0.00016893690477938941,
+                        -0.00029706437024018122, 0.00058398590652131437, -0.00053581409689064385, 0.00023108488488462049,
+                        -6.5993261189167452e-05, 8.4790978314735978e-05, 7.4314409406509176e-05, -0.00010321236186968066,
+                        1.4586659593722576e-05, -4.5363221912235467e-05, 8.450195826800364e-05, -5.4275555390907612e-05
+                    },
+                    {
+                        1.566603748095061, 1.2925121762339742, 0.63992610942415984, 0.1992081468530103,
+                        -0.013981279243252707, 0.0031328266921565326, -0.012233661227518075, -0.002436383524707634,
+                        -0.002332638951215626, 0.0050845979885575593, 0.0057948564897965316, 0.0044279372542749846,
+                        0.0010922564420263303, 0.0014764829095822718, 0.00089231960169346071, -0.00068561820542569038,
+                        0.27194564913593655, 0.22741451583924713, 0.10075736858697419, 0.029677606668180714,
+                        -0.013453161400600898, -0.00080370591194954826, -0.0053994795623645815, 0.0011777811476754978,
+                        -0.0014743660651867435, 0.0045484388973971264, 0.0062254335445828778, 0.0034293155695731816,
+                        0.0012394915037084672, 0.0011720561189519263, -0.00044772350553152281, -0.0017537490714002724,
+                        0.058614324112070841, 0.049920891330699359, 0.02156765782699693, 0.0068518384003263049,
+                        -0.0060050794470331657, -4.6152951036868941e-05, 0.00055356568690055987, 0.0015597048723604084,
+                        -0.00021512103420013966, 0.0021601453484584683, 0.0024011353184500489, 0.00050132671080411746,
+                        0.0005294431949614864, 6.189347512486538e-06, -0.00075097259341535953, -0.00095180038634680604,
+                        0.008991222602093292, 0.0081316025216975635, 0.0036785596418475938, 0.0013416218843013167,
+                        -0.0015540586446655526, 0.00035481067009540077, 0.00054802913011380082, 0.00030493317157061542,
+                        2.909209593650629e-05, 0.00053296465903752857, 0.0003818724700393306, -0.00018296632173530128,
+                        9.0655054908563162e-05, -0.00021271371294979453, -0.00021807468316235976, -0.0001174429357781252
+                    },
+                    {
+                        0.15767108320025608, 0.27556594260557593, 0.21959768517437547, 0.10440600690562274,
+                        0.17485406788284635, 0.28701891012674136, 0.1800414089064285, 0.06880639589046636,
+                        0.035566222007009519, 0.045616875265417522, 0.0017150533368245156, -0.0089090125515275346,
+                        -0.0082823909714179345, -0.015478640445849854, -0.0084138227343400016, -0.00096870663124172301,
+                        0.080090472065056192, 0.13126700701916974, 0.082268739213246872, 0.031529395951192543,
+                        0.080467945913660757, 0.11860192031420898, 0.046587952767641584, 0.0081037425508304062,
+                        0.0086340162408315019, 0.0053849356456628977, -0.0092621664097554453, -0.0060239554769266649,
+                        -0.0062352766507088727, -0.00831854073614865, 0.0017898431551980724, 0.0042226115550019977,
+                        0.015785708906463053, 0.022722504197913829, 0.0079908496305196013, 0.0009784861566518551,
+                        0.011722648800712328, 0.01327270147558714, -7.1083034604969061e-05, -0.0015957241985673932,
+                        -0.0019653865002988553, -0.0037086268720906558, -0.0010662651952444598, 0.00085513594589464595,
+                        -0.0013485624273820631, -0.00026673741076045469, 0.0021407061171964765, 0.0010713417167138033,
+                        0.0019182025293236291, 0.0023858295659570077, 0.00052464289749214687, 7.0448951332489091e-05,
+                        0.00060302871352798477, 0.0003936606591960988, 0.00037143594988623194, 0.00066488772755579075,
+                        -0.00072711340947084703, -0.00054806159717157334, 0.00059123909525328965, 0.00043727310196803234,
+                        3.123056653710368e-06, 0.00046400122176647976, 0.0001089566426639348, -0.00040048245889343022
+                    }
+                }
+            }
+        },
+        {
+            {
+                {
+                    {
+                        0.46086744320903544, 0.025360058092350871, -0.022868324831069653, 0.010080372459011522,
+                        -0.018746900017079661, 0.02763935387747796, -0.018623434814949397, 0.0053170094721293835,
+                        -0.0047717107051956711, 0.0049777451935833087, 0.0017163562913007191, -0.0034062710559705292,
+                        0.00057016345120376451, -0.0016901155668244158, 0.0023261576990537048, -0.0012057310957107859,
+                        0.1045651849868071, 0.019901094691822951, -0.014691969208285043, 0.0049867250603046233,
+                        -0.01500130130112185, 0.019946829723153262, -0.0076789690425838096, -0.0011836979722971474,
+                        -0.0030976751674133348, 0.0016627267895696807, 0.0044197534021578021, -0.0042024365824283793,
+                        0.00086140757143420151, -0.002033134524488207, 0.0012348561335985726, 3.0985879365832215e-05,
+                        0.027981030025308353, 0.009683582015179765, -0.0049936929850203241, 0.00057472657132257477,
+                        -0.0073824153163149333, 0.0081064008477924211, 0.00020930976500447833, -0.0031398260608275102,
+                        -0.00085919621352278713, -0.00086205704721915171, 0.0028930498200216703, -0.0017257232171559121,
+                        0.00070595438152139657, -0.0012596993063500204, -0.00038518433170386794, 0.0010703716520188487,
+                        0.0060497283693301913, 0.0032149562702642543, -0.001116614066014353, -0.00025102204915533117,
+                        -0.0024466475245807744, 0.0021745374954528084, 0.00091241853449448732, -0.0014510586294600254,
+                        -7.6935381746601786e-05, -0.00074103925413088135, 0.00089831974717681149, -0.00024158380762613998,
+                        0.00029953583262002482, -0.00042354270197494367, -0.00045924890720571636, 0.00064976695245345614
+                    },
+                    {
+                        2.5183415631688022, -1.9104322850734774, 0.67621862156393509, -0.068837704932402224,
+                        -0.092193272357357067, 0.23946535999208693, -0.37118599630192667, 0.22247769043158344,
+                        -0.028800431856580412, 0.0511767705018338, -0.0048063099826345544, -0.022653636010601209,
+                        0.0015549435483308823, -0.011746958273732564, 0.035951516646790894, -0.026974831152923574,
+                        0.78769480369380285, -0.51245261164646183, 0.039266454998287306, 0.087264613419078624,
+                        -0.089560454524108116, 0.20457931775175964, -0.23076152283740883, 0.10862838636699973,
+                        -0.023968433688905239, 0.029707465379738202, 0.043169895007107842, -0.055221668139776747,
+                        0.0045917832006609283, -0.016777826593422723, 0.026033449427298096, -0.014117076419729547,
+                        0.23346628643759854, -0.11941900661013549, -0.028993248767379885, 0.042885056855874154,
+                        -0.053690047587270223, 0.10372245887053563, -0.06334004924674641, 0.0057209270052851037,
+                        -0.0092609053062150497, 0.0018439491193337342, 0.041596268183033372, -0.037810425644164411,
+                        0.0055335914785054809, -0.013043905740737317, 0.0012803698230834056, 0.0071144277419128129,
+                        0.054199244932121748, -0.018933406684575972, -0.014068893236907019, 0.011051353568291017,
+                        -0.020074719406971996, 0.03395804581190498, -0.0075973907447091553, -0.0098478005329039019,
+                        -0.0017355807546378652, -0.0037659663619839441, 0.016471082160531125, -0.012098026514506846,
+                        0.0028092031466171873, -0.0053222284481656548, -0.0043046760492722221, 0.0074562789395329222
+                    },
+                    {
+                        0.62719048379493281, 0.39233351249030796, 0.13953512364274334, 0.050422648014453661,
+                        -0.024967694744218488, 0.023422245140731258, -0.0085729014201516678, -0.00043685567216435688,
+                        -0.006072117005206051, 0.0033344224634121954, 0.0027543960121375471, -0.003126252996295562,
+                        0.00081730143863345658, -0.0018204876536195042, 0.0015819414550119044, -0.00048493018093556921,
+                        0.19538883173165397, 0.14150951761398911, 0.042099085641160924, 0.016369711565202592,
+                        -0.022037882484238054, 0.017770359371298117, -0.0021155189916439521, -0.0039578040264275135,
+                        -0.004403004899756576, 0.00032082355602217934, 0.0044708586738071805, -0.0032678408242274599,
+                        0.001201198243884217, -0.0022602009885594222, 0.00074073534486900636, 0.00052382571703074089,
+                        0.058228979934510712, 0.049600175292883963, 0.013850275137185229, 0.0040112316182846549,
+                        -0.012128355722548114, 0.0071830183148626379, 0.002207212029588288, -0.0037863010646724039,
+                        -0.0015050692135872696, -0.0018693235443208718, 0.0027954024917572779, -0.0010385425828857862,
+                        0.0010152382201419061, -0.0014471221243740344, -0.00057198486548429035, 0.0012346828357388765,
+                        0.013684899227716011, 0.013670365086764608, 0.0038940082110737314, 0.0005793714306597782,
+                        -0.0043475860464427217, 0.0017599733369348164, 0.0015493096761984213, -0.0015554306025322901,
+                        -0.00025121175668230058, -0.0012343209202184601, 0.00087507604756650664, 3.0155528013591649e-05,
+                        0.00045033373872019984, -0.00049598212999413531, -0.00053122804630322494, 0.00069419221741279496
+                    },
+                    {
+                        -0.031586529427830579, 0.055952677895494199, -0.045920827720960518, 0.022104481321757519,
+                        -0.036984852655232811, 0.06119974941310298, -0.036492674959257815, 0.012219266455150124,
+                        -0.0093720423554603909, 0.01133233906681369, 0.0043877703385953315, -0.0068331018429977778,
+                        0.0011606363971187214, -0.0035718290360889173, 0.0048429056755509283, -0.0025009389886274797,
+                        -0.018243703231811723, 0.030124068190728159, -0.017730818521417072, 0.0058105391036160185,
+                        -0.020377089296377372, 0.029363388984262204, -0.0050003473858667826, -0.0045677936872515063,
+                        -0.0037288571738141106, 0.0014610887025511973, 0.0088047825758111632, -0.006878648892241877,
+                        0.001454872985066479, -0.0034010401801574737, 0.0013859041683523809, 0.0006715827106709135,
+                        -0.0058779138686944439, 0.0083914765838356536, -0.0014616404335301763, -0.0012096234311578182,
+                        -0.0056735586998244341, 0.0056933371991390331, 0.0047249926187211203, -0.0050517215642776588,
+                        -2.4037212006510207e-05, -0.0021764265278332536, 0.0034079966720940674, -0.0012051973555916753,
+                        0.00083266679296692782, -0.0013530912115083833, -0.0012370679261339567, 0.0018898329512902076,
+                        -0.0013945608437711363, 0.0016431625372549581, 0.00050050085620246393, -0.00080601552509578802,
+                        -0.0010399174236295995, 0.00032368009230319039, 0.0019737847191031621, -0.0013112447000112875,
+                        0.00031431527015238149, -0.0010683292744312204, 0.00035750687089185793, 0.00044890297504666975,
+                        0.00023930725273531078, -0.00022075262108890682, -0.00076889228087217087, 0.00079596829030567184
+                    }
+                },
+                {
+                    {
+                        0.4758288903583669, 0.0012071329829911551, -0.00098335501703361128, 0.0004641301810583726,
+                        -0.001253308212058941, 0.0014395652693134154, -0.00115848744952817, 0.00054113052221936716,
+                        -0.00037208492441422183, 0.00042036649437347264, -0.00032047152528309031, 0.000142551313807064,
+                        2.1617768414901733e-06, -6.2989269578834886e-06, 1.461433472402996e-05, -1.0632899431636353e-05,
+                        0.11692460713548368, 0.0010120309799700254, -0.00081712792038394697, 0.00038276557779116254,
+                        -0.0010517432878094789, 0.0012012330886951596, -0.00094927764681309093, 0.00043641534326810649,
+                        -0.00030972460568340945, 0.00034354476984118764, -0.00024596731087347983, 0.00010273364028659049,
+                        3.2145285429132674e-06, -9.1853326404896644e-06, 2.0725329534755283e-05, -1.4944414641017428e-05,
+                        0.034529043373999153, 0.00056092312357732216, -0.00044540785955560452, 0.00020564166629243722,
+                        -0.00058393292135817888, 0.00065991082381510662, -0.00050387430142373696, 0.00022449575794942266,
+                        -0.00016927278610002653, 0.00018127871664563161, -0.00011408411477448732, 4.0750902546830337e-05,
+                        3.2849440275530873e-06, -9.0591033284564606e-06, 1.9376465851525851e-05, -1.3721569615909616e-05,
+                        0.0083921487582258331, 0.00021059971727070429, -0.00016480465902945384, 7.5104349986915295e-05,
+                        -0.00021955643824720698, 0.0002458483912774093, -0.00018203243660672635, 7.872616467798966e-05,
+                        -6.2755830144690909e-05, 6.5102039078826913e-05, -3.5853240846384879e-05, 1.0273003827846692e-05,
+                        1.732985193600616e-06, -4.6770061615751727e-06, 9.661966008904529e-06, -6.7576072293275876e-06
+                    },
+                    {
+                        0.64813244725884356, -0.36796051803148205, 0.148758398456589, -0.044839800606286534,
+                        -0.00085653847637787292, 0.0025843770463408549, -0.0040920585284968895, 0.0025756378101367658,
+                        -0.00025510132621165121, 0.0007593724858270237, -0.0011541457922038853, 0.00071114785684807814,
+                        1.0798086137609829e-06, -8.7591779990276491e-06, 3.9726611246052924e-05, -3.319175671635146e-05,
+                        0.21429075108518672, -0.1205985631960982, 0.047217340603019117, -0.013555321601458758,
+                        -0.0010582974563874234, 0.0025527335595083131, -0.0038214827452619257, 0.0023706396152509955,
+                        -0.00031550433264708526, 0.0007403401189768127, -0.0010313860586426767, 0.00061534739504473805,
+                        1.220657261924765e-06, -1.3979632479462927e-05, 6.160010200589503e-05, -5.1104053441869952e-05,
+                        0.069240681348483213, -0.038484143178924984, 0.014378831891711512, -0.0038188994770065638,
+                        -0.00080286707350768786, 0.0016519116890504407, -0.0023256493548638253, 0.0014139814285137184,
+                        -0.00023898096162196412, 0.00046697964130279116, -0.00057509190177771415, 0.00032308100968291053,
+                        1.2516305196155891e-06, -1.5637627174462083e-05, 6.4392568472462493e-05, -5.2720477628211284e-05,
+                        0.017863978085958191, -0.0097860671300378059, 0.0034541769533125133, -0.00082319218828512419,
+                        -0.00035128240006060879, 0.00067330186046701769, -0.00091194583281131193, 0.00054615714410377754,
+                        -0.00010431148727625605, 0.00018619649187130174, -0.0002079845502613265, 0.00011006445824556481,
+                        7.3291172948134668e-07, -8.6210184032184406e-06, 3.4050121468975246e-05, -2.7653453316618768e-05
+                    },
+                    {
+                        2.5842581945649985, 2.1158456124817993, 1.0666159649279632, 0.33166375682153271,
+                        -0.0082630653103254476, -0.0076408378713417767, -0.022884054430327629, -0.013776790165706172,
+                        -0.0025585056806496404, -0.0016525280816539689, -0.0024557185007430945, -0.00039552130298823582,
+                        2.3028704368261519e-05, 0.00037359213839768726, 0.0017688397761998686, 0.0014059470617133665,
+                        0.85141029504343646, 0.69526472966295261, 0.33807194510547028, 0.10033962149309331,
+                        -0.00959783798194596, -0.0095223273375089519, -0.020985140188428675, -0.011506964541920848,
+                        -0.0028631873907219415, -0.0017277057077626798, -0.00038360051729765485, 0.0013558083166732256,
+                        0.00012417740055696764, 0.00063165445996712704, 0.002007935570161799, 0.0014357320787574805,
+                        0.27354976827409566, 0.22267757234768795, 0.10426069108213105, 0.029735947832696487,
+                        -0.0067915253773522897, -0.0061920206091918163, -0.0096752655156782229, -0.004066978794567252,
+                        -0.0018226715386914459, -0.00062442282689106345, 0.0014038657534022451, 0.0019601087112703143,
+                        0.00022285833366289309, 0.00062084103786651734, 0.00095822047384842412, 0.00042963012279219933,
+                        0.070120415263689978, 0.056974520378865433, 0.025908664519264525, 0.0072680174768035505,
+                        -0.0028361386300513815, -0.0023250729663888779, -0.0026834165874697548, -0.0006576158025303272,
+                        -0.00068578474778798208, -5.1544300650725507e-05, 0.00090856711254852138, 0.00094441848145602439,
+                        0.00013681074743132621, 0.00030061985755763912, 0.00019913593267204013, -4.9559813127642981e-05
+                    },
+                    {
+                        0.031730447102349603, 0.059197258560754897, 0.059196446210461322, 0.032851735611021171,
+                        0.037785992888921142, 0.068952905336062825, 0.063203226045181846, 0.03305494912480663,
+                        0.010788841670207798, 0.018095234571943338, 0.011227800519396201, 0.003935110312722011,
+                        -0.00037288244947835287, -0.0013813791729096032, -0.0032532465158429161, -0.0023502139192776304,
+                        0.018642226276862059, 0.033999786006746031, 0.031075079992537662, 0.016214916294760642,
+                        0.021901155804180145, 0.038350619945478823, 0.029483683034037804, 0.013326739184808423,
+                        0.0057682939429336486, 0.0085915947750062564, 0.002068007443344724, -0.00088608290838302457,
+                        -0.00051927515552925097, -0.0014909318134348176, -0.002361328100480314, -0.0014384108755384171,
+                        0.0063902003787123076, 0.011156494606800469, 0.008512653805782389, 0.0038296357017591769,
+                        0.0072129058346905488, 0.011679888100969335, 0.0061002819309178332, 0.0015971180619175965,
+                        0.0014999183439731488, 0.0016676433137769635, -0.00098950826219877251, -0.0012250410246777376,
+                        -0.00038835641775590113, -0.00084475661810405871, -0.00055995936076035102, -8.9054686721073972e-05,
+                        0.0016718182630559755, 0.0027875931596972169, 0.0017258165852741618, 0.00061330187701724205,
+                        0.0017831554583313783, 0.0026486389449321499, 0.00076520989763593594, -0.00013073578143858687,
+                        0.00024428651681958786, 0.00011528762910867281, -0.00044448641743598163, -0.00032576512523766577,
+                        -0.00015539813745515284, -0.00027563667610847487, 1.5210784327249519e-05, 0.00015030023536760984
+                    }
+                }
+            },
+            {
+                {
+                    {
+                        0.32426196644100275, 0.14172440330758745, -0.025445141895683216, -0.015696599716782653,
+                        -0.10350803375584283, 0.033000817485550997, 0.033421768333480623, -0.014319148307120217,
+                        0.015222894865844654, -0.041278806157136541, 0.0071096084726136764, 0.013403032382646935,
+                        0.0040847325517813704, 0.012507669806973947, -0.013033668709570592, -0.00052359990112198923,
+                        0.029244668474287375, 0.051995909401754227, 0.0096143657334434619, -0.011242928544777143,
+                        -0.036763903043565464, -0.024927882225424334, 0.017694513664220052, 0.011196652814509584,
+                        0.018115451235507292, -0.018840439635177435, -0.010902684437672431, 0.011380796683385994,
+                        -0.0038007719225462483, 0.018326665866148156, -0.00066208206197780465, -0.01149184780277813,
+                        0.0055496814587180218, 0.0069725084407243985, 0.0052844031058770016, 0.00010982134132406515,
+                        -0.0049260208602579349, -0.012289454254656529, -0.0016208680298812374, 0.006677080952956437,
+                        0.0064681460942076193, 0.001876385363748894, -0.0054822529435529267, -0.001086075323192922,
+                        -0.0034435440565144674, 0.0044173506181856099, 0.0039673837541824106, -0.0037278263500768109,
+                        0.0009628575675530303, 0.00063705768940115412, 0.0008240588080928046, 0.00072790211070289422,
+                        -0.00056996038501089675, -0.0012532111550616083, -0.0013403185399077653, -2.4436220256463267e-05,
+                        0.0012394836183014144, 0.0020085875072424503, -0.00061498600542090568, -0.0016100209561394176,
+                        -0.00094930380563753279, -0.00076267285487702425, 0.0011891805392349949, 0.00087166709537271441
+                    },
+                    {
+                        1.7668174309488667, -0.63003940885474319, -0.13521854176600526, 0.10030744804051717,
+                        -0.56787282364434777, 0.64841740987808094, -0.060632143273469385, -0.14615781600267821,
+                        0.09671157043239953, -0.3106159516060743, 0.23920738361348001, -0.033579245602107018,
+                        0.025396645601822067, 0.05533832402503968, -0.16094346844780971, 0.091152407899494095,
+                        0.29057656284959738, 0.12761332183234866, -0.085187989474103096, -0.037114406365059228,
+                        -0.24316492087256955, 0.069465302454060143, 0.13136929179184706, -0.047782111317094866,
+                        0.1223447242652777, -0.2220864526616205, 0.011357200157518559, 0.094239475359439717,
+                        -0.027696838521211475, 0.13342581084860736, -0.064235102299132818, -0.038767975156813142,
+                        0.055598542079262715, 0.025640452471145082, 0.012391114926339581, -0.019163317361735249,
+                        -0.044500024461528627, -0.046800620019197096, 0.016594362042322841, 0.036107693053226191,
+                        0.048011313637629185, -0.037148386263937107, -0.034581871835034951, 0.028686727745302988,
+                        -0.027610450694219836, 0.055318904299160393, 0.016521503749004993, -0.043767210360722217,
+                        0.0092521768721399965, 0.001560931793713468, 0.0029782456927965667, 0.00067233019170826131,
+                        -0.0071465397848423312, -0.00918778332472194, -0.0040850068823495445, 0.0080401947173092039,
+                        0.0094649465074665567, 0.0036278170112964757, -0.0075891633671641761, -0.003705037233455171,
+                        -0.008400168246766709, 0.0045969422939686434, 0.0086979153571339965, -0.0043261336944601294
+                    },
+                    {
+                        0.44908206878953033, 0.45147129015340098, 0.17172674098568108, 0.027603996565734583,
+                        -0.1347452860089233, -0.028015120460108383, 0.041617680876205515, 0.0048113217138588951,
+                        0.020123366622720407, -0.043369863116213214, -0.0062234269593073035, 0.017577087799788099,
+                        0.0057791205076935855, 0.019978937741200329, -0.0099459049644532102, -0.0075299149229409975,
+                        0.080187778432112, 0.13422815251883355, 0.075514758346426125, 0.010354757576234169,
+                        -0.061583796061814008, -0.063312814024571368, 0.010127307860284452, 0.022801972829154367,
+                        0.02555889748783997, -0.015605829797546617, -0.018985919865698787, 0.0074614358380303289,
+                        -0.0036980989345160283, 0.023875244537425393, 0.0028805166531672738, -0.014898516439823019,
+                        0.015853879398157977, 0.026975499111161969, 0.023823767816721589, 0.0083955979686717846,
+                        -0.013505066371007084, -0.027254840008608689, -0.0088585097179897584, 0.0073085406186115479,
+                        0.011202854567611073, 0.0060017056919426321, -0.0082760600429792001, -0.0047689465439064273,
+                        -0.0051246304152231031, 0.0052250795040696858, 0.0064007326517885581, -0.0030062815502155927,
+                        0.0024929266603698885, 0.0039145353391035935, 0.0048598416771978197, 0.0028647916292748325,
+                        -0.0022725714544986285, -0.0050550707311464889, -0.0044830780749885012, -0.00096871394310890971,
+                        0.0026708437518066707, 0.0039442566919450179, -0.0011999868066520896, -0.0028967494040839101,
+                        -0.0020119166655293056, -0.001460111220186331, 0.0021923449288672146, 0.0017706084716673236
+                    },
+                    {
+                        -0.29677655233617206, 0.33451541380426125, -0.021536605163858663, -0.019161934077305001,
+                        -0.19668012081224473, 0.10668681420411529, 0.10511771370933741, -0.014842036979364676,
+                        0.032648472040971641, -0.082709822407917008, 0.020940745521618929, 0.031245055070040217,
+                        0.0073461752703811662, 0.0230710984885436, -0.029915280651661436, -0.0017718608179909088,
+                        -0.096644252810056008, 0.05400038662982596, 0.050589512001418015, -0.0079402449737121343,
+                        -0.017284062837549883, -0.055335506108772803, 0.03620107985004125, 0.038897009213991619,
+                        0.028954369558650443, -0.020030989536051095, -0.026698757304475677, 0.017642799893287629,
+                        -0.010189515126468299, 0.030616882583954921, 0.0029534347742583233, -0.025057754144146623,
+                        -0.0074861543528793231, -0.010824731079913842, 0.010668623914899648, 0.0081331630531529114,
+                        0.011067896666116432, -0.011626366534246479, -0.009896122487041031, 0.010149772175623717,
+                        0.0028230825316613375, 0.011785541761728038, -0.0072961205274322174, -0.0081845082062460307,
+                        -0.0045886442981907302, 0.00025957624583950638, 0.0076783771099850672, -0.0029374144992861694,
+                        0.00036621557211328148, -0.0019259217402581399, -0.00048022748460729413, 0.002034728074586256,
+                        0.0014896548175523062, 0.0040130625389993213, -0.0022962307915103735, -0.0036956962931911337,
+                        -0.0010148598095443241, 0.0030916023327233941, 0.0011483702264057022, -0.0033154484959703888,
+                        -6.9279528636232254e-05, -0.0038747251814595972, 0.00051676084643824014, 0.00385952653217776
+                    }
+                },
+                {
+                    {
+                        0.46073156004359234, 0.01763961841878689, -0.012154827602159489, 0.0048928838921719672,
+                        -0.01856115995917294, 0.019129623332060211, -0.010847840157326609, 0.0033740871955199587,
+                        -0.0045380970435946796, 0.0034226130482266056, 0.00018191633854037305, -0.0010635295756167243,
+                        0.00055831483321473003, -0.0011383105626806306, 0.0013032066256190101, -0.00065882054674543198,
+                        0.10462823437374202, 0.013796125656976922, -0.0082899029282217981, 0.0028205523381622261,
+                        -0.014622985309420336, 0.013769211059891125, -0.0054470584057685432, 0.00054405738740003298,
+                        -0.0029415985026389709, 0.0011788081470099198, 0.0018915004676517569, -0.0016933995798698736,
+                        0.0007531423988376961, -0.0013446377686990416, 0.00099178887055439025, -0.00027810544590695839,
+                        0.02809416873663555, 0.0067062167322826383, -0.003117262190331504, 0.00065458729223272878,
+                        -0.0071636751266827671, 0.0056309075043255484, -0.00061777782051327128, -0.00095315468070144313,
+                        -0.00088332567642584916, -0.00053993920063044609, 0.0016087701962687832, -0.00091129774214837795,
+                        0.0005976821534624644, -0.00084396219736076734, 9.9542577628463334e-05, 0.00028032669180888753,
+                        0.0061003856663792901, 0.0022305336983909118, -0.00078266753484440099, 2.8062758912173064e-05,
+                        -0.0023927833369213835, 0.0015341831806175976, 0.00030442589044250097, -0.00057397195807387354,
+                        -0.00012152820518934889, -0.00048542158008071625, 0.00060237434946944365, -0.00021962577072234997,
+                        0.00025885848665231658, -0.0002943916068548091, -0.00013782503878031886, 0.00024210492880188733
+                    },
+                    {
+                        0.63778563685402323, -0.33787406260297781, 0.10670063928301912, -0.020111805915845517,
+                        -0.012621998338843143, 0.035718062339535506, -0.044164888736044003, 0.023969342442052174,
+                        -0.0027763941797166883, 0.0071982525012696729, -0.00334533853222139, -0.00029406410034163287,
+                        0.00062557603163903002, -0.0017892561370559039, 0.0039275319894054063, -0.0027376629317473135,
+                        0.20155352165159915, -0.092184263062734903, 0.012739236004849306, 0.0053457015825298911,
+                        -0.015448832159567485, 0.032154273621754548, -0.031247193067972221, 0.014291300967260985,
+                        -0.0033598656450863395, 0.0046740464279916979, 0.002296744450516525, -0.0039876976110382652,
+                        0.0007380846399959954, -0.0023573307896387996, 0.0037350371415693605, -0.002187764756757072,
+                        0.059788035810986198, -0.02162140410480513, -0.0022357607743704157, 0.0041226330375168123,
+                        -0.01124167308662357, 0.017391215791151247, -0.010996904800713825, 0.0027979004068842319,
+                        -0.0025102981940267124, 0.00091406834979112193, 0.0041820679365535893, -0.0037467614837326762,
+                        0.00030591193304281165, -0.0016947048279589935, 0.0012390549166533908, -0.00014394380517570958,
+                        0.013821093044429338, -0.0034150291046086642, -0.001801944405847589, 0.0013124290229459391,
+                        -0.0047203677177646078, 0.0060087747963530752, -0.0022158994789908287, -0.00031616526876997414,
+                        -0.0011115912685062206, -0.00018792956397461238, 0.0020608399903171235, -0.0014946409830859382,
+                        3.9396306270229772e-06, -0.00065337532372994431, 1.9007360398878658e-05, 0.00040029094647806105
+                    },
+                    {
+                        2.497030196999479, 2.0853438527591717, 0.99042720734395551, 0.30762085833096731,
+                        -0.089594327122642411, 0.00671030181393905, -0.014236044025044669, 0.0085098050741411468,
+                        -0.0061094247069910148, 0.029078671063864293, 0.033182406400196096, 0.010976538103041921,
+                        0.0067903681956766916, 1.7651936597941169e-05, -0.0054263993260190626, -0.008430197014466739,
+                        0.76135763309796256, 0.66526204374357856, 0.29613192150004869, 0.094651721380755074,
+                        -0.085669463950985125, 0.0086788180484319542, 0.0095152787629690753, 0.0095378952157519625,
+                        -0.0029045574259512967, 0.021229514006298373, 0.023921623263293407, 0.00064391076481814017,
+                        0.0046301565481581125, -0.0075767200483454009, -0.0077593208947238004, -0.0048182539071165752,
+                        0.21952889257155489, 0.21085540964949545, 0.097279476331690845, 0.032204789065190323,
+                        -0.048421835524079991, 0.0042215169954207578, 0.010512404108317578, 3.3212238012435993e-05,
+                        -0.0028516323824609251, 0.00039108911976303554, 0.005099592312906423, -0.0032969259582690982,
+                        -0.00036624307109078347, -0.0095843115218449942, -0.0046845113955903059, 0.0014191341779420908,
+                        0.049942535959169192, 0.05407744073905553, 0.026214370335839149, 0.0082495008607424772,
+                        -0.017863988540426149, -0.00051820054124543141, 0.0033535915109881801, -0.0016607593837472949,
+                        -0.0021758656031730253, -0.0043471764266907291, -0.00051655554740149092, -0.0011468280275968097,
+                        -0.0012284829176799044, -0.004574663267969137, -0.0019062880787544816, 0.0013462136051517401
+                    },
+                    {
+                        0.414545911420937, 0.67505691841546001, 0.43329490546089239, 0.17630371922885427,
+                        0.39872204337144723, 0.59766338481992431, 0.28383143023327867, 0.086030178576473437,
+                        0.036622801763188904, 0.035828988224784405, -0.015869308650139281, -0.014830397085737834,
+                        -0.026633992378189204, -0.029504491531009303, 0.0045143997492436859, 0.0078968622481569977,
+                        0.19562367788288676, 0.29359424913869431, 0.14023780168871233, 0.042867180998120695,
+                        0.14766625577963766, 0.2001076868973235, 0.065001531985619199, 0.01359099674258428,
+                        -0.014629703664940655, -0.018947541816528177, -0.0041043775315081962, 0.00094731881770595769,
+                        -0.011493967142119225, -0.0035041041527613731, 0.01037400218726341, 0.0019875071986094972,
+                        0.043257357857868411, 0.060520073181404822, 0.021895233823265869, 0.00490258740761749,
+                        0.015891916205139803, 0.024875151385615205, 0.01302956394219525, 0.0046648532923638172,
+                        -0.012929655710551644, -0.0097484231627843441, 0.0051473910594265967, 0.0019379740270714233,
+                        7.3798236266932506e-05, 0.0022235505177693278, 0.00040416233638922752, -0.0021146333661456566,
+                        0.0067857400599550142, 0.010192372619073747, 0.0046677690595667348, 0.0013736725921480307,
+                        -0.0007646110504525807, 0.0031918507262714748, 0.0050257118738422446, 0.001102633320500646,
+                        -0.0032324657979745665, -0.001769470461572726, 0.0014020935637710852, -0.00019942381529703963,
+                        0.00082054426309416905, -0.00021945273579328264, -0.0011057851846843019, -8.4230355650359354e-05
+                    }
+                }
+            }
+        }
+    };
+}
+
+#endif //ORFANIDISSURROGATEDATA_H_INCLUDED
@@ -0,0 +1,192 @@
+/*
+  ==============================================================================
+
+    OrfanidisTable.cpp
+    Created: 17 Oct 2026 3:24:00am
+    Author:  StoneyDSP
+
+  ==============================================================================
+*/
+
+#include "OrfanidisTable.h"
+
+//==============================================================================
+OrfanidisTableGrids::OrfanidisTableGrids()
+{
+}
+
+std::shared_ptr<const OrfanidisTableGrids::Grid> OrfanidisTableGrids::get(double sampleRate)
+{
+    jassert(sampleRate > 0);
+
+    const juce::ScopedLock sl(lock);
+
+    // Drop the rates no table holds any more, on the way to this one.
+    std::shared_ptr<const Grid> found;
+
+    for (auto it = grids.begin(); it != grids.end();)
+    {
+        auto held = it->second.lock();
+
+        if (held == nullptr)
+        {
+            it = grids.erase(it);
+            continue;
+        }
+
+        if (it->first == sampleRate)
+            found = held;
+
+        ++it;
+    }
+
+    if (found == nullptr)
+    {
+        found = build(sampleRate);
+        grids.emplace_back(sampleRate, found);
+    }
+
+    return found;
+}
+
+std::shared_ptr<const OrfanidisTableGrids::Grid> OrfanidisTableGrids::build(double sampleRate)
+{
+    const auto omega = (2.0 * juce::MathConstants<double>::pi) / sampleRate;
+    const auto limit = sampleRate * 0.5 * 0.65;
+    const auto nyquistLimit = sampleRate / 2.125;
+
+    auto grid = std::make_shared<Grid>();
+    grid->nodes.resize(static_cast<size_t>(numFrequencies * numBandwidths * numGains));
+    grid->maxFrequency = minFrequency;
+
+    for (int f = 0; f < numFrequencies; ++f)
+    {
+        const auto nodeFrequency = minFrequency * unwarp(static_cast <double> (f) / frequencyStepsPerOctave);
+
+        if (nodeFrequency <= limit)
+            grid->maxFrequency = nodeFrequency;
+
+        // Nodes above the usable range are never interpolated from, but keep
+        // them below Nyquist so that every node is finite.
+        const auto frequency = juce::jmin(nodeFrequency, nyquistLimit);
+
+        for (int b = 0; b < numBandwidths; ++b)
+        {
+            const auto bandwidth = minBandwidth * unwarp(static_cast <double> (b) / bandwidthStepsPerOctave);
+
+            for (int g = 0; g < numGains; ++g)
+            {
+                const auto gain = minGain + (maxGain - minGain) * static_cast <double> (g) / static_cast <double> (numGains - 1);
+
+                grid->nodes[getIndex(f, b, g)] = OrfanidisDesign<double>::calculate(frequency, bandwidth, gain, omega);
+            }
+        }
+    }
+
+    return grid;
+}
+
+double OrfanidisTableGrids::unwarp(double position) noexcept
+{
+    const auto exponent = std::floor(position);
+
+    return std::ldexp(1.0 + (position - exponent), static_cast<int>(exponent));
+}
+
+//==============================================================================
+template <typename SampleType>
+OrfanidisTable<SampleType>::OrfanidisTable()
+{
+}
+
+//==============================================================================
+template <typename SampleType>
+void OrfanidisTable<SampleType>::prepare(double sampleRate)
+{
+    grid = grids->get(sampleRate);
+    maxFrequency = static_cast <SampleType> (grid->maxFrequency);
+}
+
+template <typename SampleType>
+void OrfanidisTable<SampleType>::release()
+{
+    grid.reset();
+    maxFrequency = minFrequency;
+}
+
+//==============================================================================
+template <typename SampleType>
+SampleType OrfanidisTable<SampleType>::warp(SampleType x) noexcept
+{
+    int exponent;
+    const auto mantissa = std::frexp(x, &exponent);
+
+    return static_cast<SampleType>(exponent - 1) + (mantissa * SampleType(2.0) - SampleType(1.0));
+}
+
+//==============================================================================
+template <typename SampleType>
+bool OrfanidisTable<SampleType>::covers(SampleType frequency, SampleType bandwidth, SampleType gain) const noexcept
+{
+    return isPrepared()
+        && minFrequency <= frequency && frequency <= maxFrequency
+        && minBandwidth <= bandwidth && bandwidth <= maxBandwidth
+        && minGain <= gain && gain <= maxGain;
+}
+
+template <typename SampleType>
+CoefficientSet<SampleType> OrfanidisTable<SampleType>::lookup(SampleType frequency, SampleType bandwidth, SampleType gain) const noexcept
+{
+    jassert(covers(frequency, bandwidth, gain));
+
+    if (OrfanidisDesign<SampleType>::isFlat(gain))
+        return {};
+
+    // Splits a grid position into a cell index and the fraction across it.
+    const auto locate = [] (SampleType position, int numPoints, int& index) noexcept
+    {
+        index = juce::jlimit(0, numPoints - 2, static_cast<int>(position));
+        return position - static_cast<SampleType>(index);
+    };
+
+    int f, b, g;
+    const auto tf = locate(warp(frequency / minFrequency) * static_cast<SampleType>(frequencyStepsPerOctave), numFrequencies, f);
+    const auto tb = locate(warp(bandwidth / minBandwidth) * static_cast<SampleType>(bandwidthStepsPerOctave), numBandwidths, b);
+    const auto tg = locate((gain - minGain) * static_cast<SampleType>(numGains - 1) / (maxGain - minGain), numGains, g);
+
+    const SampleType one = 1.0;
+    const SampleType wf[2] = { one - tf, tf };
+    const SampleType wb[2] = { one - tb, tb };
+    const SampleType wg[2] = { one - tg, tg };
+
+    // Accumulated in double: at low frequencies a1 and a2 sit close to -2
+    // and 1, and float sums of eight nodes would move the poles audibly.
+    double sum[5] = {};
+
+    for (int i = 0; i < 2; ++i)
+        for (int j = 0; j < 2; ++j)
+            for (int k = 0; k < 2; ++k)
+            {
+                const auto& node = grid->nodes[Grids::getIndex(f + i, b + j, g + k)];
+                const auto w = static_cast<double>(wf[i] * wb[j] * wg[k]);
+
+                sum[0] += w * node.b0;
+                sum[1] += w * node.b1;
+                sum[2] += w * node.b2;
+                sum[3] += w * node.a1;
+                sum[4] += w * node.a2;
+            }
+
+    CoefficientSet<SampleType> set;
+    set.b0 = static_cast<SampleType>(sum[0]);
+    set.b1 = static_cast<SampleType>(sum[1]);
+    set.b2 = static_cast<SampleType>(sum[2]);
+    set.a1 = static_cast<SampleType>(sum[3]);
+    set.a2 = static_cast<SampleType>(sum[4]);
+
+    return set;
+}
+
+//==============================================================================
+template class OrfanidisTable<float>;
+template class OrfanidisTable<double>;
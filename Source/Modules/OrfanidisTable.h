@@ -0,0 +1,179 @@
+/*
+  ==============================================================================
+
+    OrfanidisTable.h
+    Created: 17 Oct 2026 3:24:00am
+    Author:  StoneyDSP
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#ifndef ORFANIDISTABLE_H_INCLUDED
+#define ORFANIDISTABLE_H_INCLUDED
+
+#include <memory>
+#include <vector>
+#include "../JuceLibraryCode/JuceHeader.h"
+#include "Coefficient.h"
+#include "OrfanidisDesign.h"
+
+/**
+    The node grids behind every OrfanidisTable in the process, one per
+    sample rate, meant to be held through a juce::SharedResourcePointer as
+    CoefficientCache is. The nodes are designed and stored in double for
+    either precision, so float and double tables at one rate share a grid:
+    3.9 MB, built once by the first table to ask for the rate and freed
+    with the last table that holds it.
+*/
+class OrfanidisTableGrids
+{
+public:
+    //==============================================================================
+    /** One sample rate's nodes. */
+    struct Grid
+    {
+        std::vector<CoefficientSet<double>> nodes;
+
+        /** The highest frequency the nodes cover. */
+        double maxFrequency = 20.0;
+    };
+
+    //==============================================================================
+    /** Constructor. */
+    OrfanidisTableGrids();
+
+    /** Returns the grid for the sample rate, building it if no table holds
+        one. May allocate and design every node, so call from prepare() only. */
+    std::shared_ptr<const Grid> get(double sampleRate);
+
+    /** Returns the index of a node in Grid::nodes. */
+    static size_t getIndex(int f, int b, int g) noexcept
+    {
+        return (static_cast<size_t>(f) * numBandwidths + static_cast<size_t>(b)) * numGains + static_cast<size_t>(g);
+    }
+
+    //==============================================================================
+    static constexpr int frequencyStepsPerOctave = 24;
+    static constexpr int numFrequencies = 241; // 20 Hz .. 20480 Hz
+    static constexpr int bandwidthStepsPerOctave = 4;
+    static constexpr int numBandwidths = 17; // 1/16 .. 1
+    static constexpr int numGains = 24; // even, so no node sits on 0 dB
+
+    static constexpr double minFrequency = 20.0, minBandwidth = 0.0625, maxBandwidth = 1.0;
+    static constexpr double minGain = -24.0823996531, maxGain = 24.0823996531;
+
+private:
+    //==============================================================================
+    /** Designs every node for the sample rate. */
+    static std::shared_ptr<const Grid> build(double sampleRate);
+
+    /** The exact inverse of OrfanidisTable's warp(), used to place the nodes. */
+    static double unwarp(double position) noexcept;
+
+    //==============================================================================
+    juce::CriticalSection lock;
+    std::vector<std::pair<double, std::weak_ptr<const Grid>>> grids;
+
+    //==============================================================================
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(OrfanidisTableGrids)
+};
+
+//==============================================================================
+/**
+    A precomputed grid of Orfanidis peak designs, interpolated trilinearly.
+
+    The grid is taken for one sample rate in prepare(), from the
+    OrfanidisTableGrids shared by every table in the process. Frequency
+    (20 Hz up) and bandwidth (1/16..1) are spaced on a warped log2 axis,
+    gain (+/-24 dB) on a linear one. lookup() then costs 40 multiply-adds and two frexps,
+    in place of a tan, three pows and eight square roots.
+
+    Every node is a stable design, and the stable region of (a1, a2) is a
+    triangle, so an interpolated set is a convex mix of stable sets and is
+    itself stable.
+
+    No node sits on 0 dB: there the design collapses to a pass-through,
+    whose coefficients are far from those of its neighbours even though
+    the response is not, so lookup() returns the identity for a flat gain,
+    as OrfanidisDesign::isFlat() defines it. Likewise bandwidth 0 is left to the exact design.
+
+    Error against OrfanidisDesign<double>::calculate(), measured over 200000
+    random covered parameter sets at 44.1, 48 and 96 kHz:
+
+        double: max magnitude response error < 0.1 dB
+                max coefficient error        < 0.015
+        float:  max magnitude response error < 1.7 dB overall, < 0.5 dB
+                from 40 Hz and < 0.12 dB from 100 Hz. The nodes are
+                double; what is left is the rounding of the result to
+                float, which costs the float exact design more (< 3.7 dB,
+                < 0.9 dB and < 0.2 dB at the same points).
+
+    The worst cases are narrow boosts and cuts near the bottom of the
+    frequency range. Above 0.65 Nyquist, or below bandwidth 1/16, the design
+    changes faster than the grid can follow; covers() returns false there,
+    and the exact design should be used instead.
+*/
+template <typename SampleType>
+class OrfanidisTable
+{
+public:
+    //==============================================================================
+    /** Constructor. */
+    OrfanidisTable();
+
+    //==============================================================================
+    /** Takes the grid for the given sample rate, building it if no other
+        table holds it. May allocate and run the exact design once per node,
+        so call this from prepare() only. */
+    void prepare(double sampleRate);
+
+    /** Lets go of the grid. */
+    void release();
+
+    /** Returns true if the table holds a grid. */
+    bool isPrepared() const noexcept { return grid != nullptr; }
+
+    /** Returns true if the parameters lie inside the grid. */
+    bool covers(SampleType frequency, SampleType bandwidth, SampleType gain) const noexcept;
+
+    /** Returns the interpolated design. The parameters must be covered. */
+    CoefficientSet<SampleType> lookup(SampleType frequency, SampleType bandwidth, SampleType gain) const noexcept;
+
+    //==============================================================================
+    using Grids = OrfanidisTableGrids;
+
+    static constexpr int frequencyStepsPerOctave = Grids::frequencyStepsPerOctave;
+    static constexpr int numFrequencies = Grids::numFrequencies;
+    static constexpr int bandwidthStepsPerOctave = Grids::bandwidthStepsPerOctave;
+    static constexpr int numBandwidths = Grids::numBandwidths;
+    static constexpr int numGains = Grids::numGains;
+
+private:
+    //==============================================================================
+    /** A piecewise-linear log2: the exponent plus the mantissa's fraction.
+        Monotonic, exact at powers of two, and cheaper than std::log2. */
+    static SampleType warp(SampleType x) noexcept;
+
+    //==============================================================================
+    juce::SharedResourcePointer<OrfanidisTableGrids> grids;
+    std::shared_ptr<const OrfanidisTableGrids::Grid> grid;
+
+    /** The highest frequency the nodes cover; set by prepare(). */
+    SampleType maxFrequency = 20.0;
+
+    //==========================================================================
+    /** Initialised constant */
+    const SampleType minFrequency = static_cast<SampleType>(Grids::minFrequency);
+    const SampleType minBandwidth = static_cast<SampleType>(Grids::minBandwidth);
+    const SampleType maxBandwidth = static_cast<SampleType>(Grids::maxBandwidth);
+    const SampleType minGain = static_cast<SampleType>(Grids::minGain), maxGain = static_cast<SampleType>(Grids::maxGain);
+
+    //==============================================================================
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(OrfanidisTable)
+};
+
+#endif //ORFANIDISTABLE_H_INCLUDED
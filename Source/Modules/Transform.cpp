@@ -24,12 +24,7 @@ void Transformations<SampleType>::prepare(juce::dsp::ProcessSpec& spec)
 {
     jassert(spec.numChannels > 0);
 
-    Wn_1.resize(spec.numChannels);
-    Wn_2.resize(spec.numChannels);
-    Xn_1.resize(spec.numChannels);
-    Xn_2.resize(spec.numChannels);
-    Yn_1.resize(spec.numChannels);
-    Yn_2.resize(spec.numChannels);
+    state.prepare(spec.numChannels);
 
     reset(static_cast<SampleType>(0.0));
 
@@ -39,8 +34,7 @@ void Transformations<SampleType>::prepare(juce::dsp::ProcessSpec& spec)
 template <typename SampleType>
 void Transformations<SampleType>::reset(SampleType initialValue)
 {
-    for (auto v : { &Wn_1, &Wn_2, &Xn_1, &Xn_2, &Yn_1, &Yn_2 })
-        std::fill(v->begin(), v->end(), initialValue);
+    state.reset(initialValue);
 }
 
 template <typename SampleType>
@@ -60,118 +54,71 @@ void Transformations<SampleType>::setTransformType(TransformationType newTransfo
     if (transformType != newTransformType)
     {
         transformType = newTransformType;
+        state.setTransformType(transformType);
         reset(static_cast<SampleType>(0.0));
     }
 }
 
 template <typename SampleType>
-SampleType Transformations<SampleType>::processSample(int channel, SampleType inputValue)
+void Transformations<SampleType>::setNonRealtime(bool isNonRealtime, juce::ThreadPool* threadPool)
 {
-    jassert(juce::isPositiveAndBelow(channel, Wn_1.size()));
-    jassert(juce::isPositiveAndBelow(channel, Wn_2.size()));
-    jassert(juce::isPositiveAndBelow(channel, Xn_1.size()));
-    jassert(juce::isPositiveAndBelow(channel, Xn_2.size()));
-    jassert(juce::isPositiveAndBelow(channel, Yn_1.size()));
-    jassert(juce::isPositiveAndBelow(channel, Yn_1.size()));
-
-
-    switch (transformType)
+    if (! isNonRealtime)
     {
-    case TransformationType::directFormI:
-        inputValue = directFormI(channel, inputValue);
-        break;
-    case TransformationType::directFormII:
-        inputValue = directFormII(channel, inputValue);
-        break;
-    case TransformationType::directFormItransposed:
-        inputValue = directFormITransposed(channel, inputValue);
-        break;
-    case TransformationType::directFormIItransposed:
-        inputValue = directFormIITransposed(channel, inputValue);
-        break;
-    default:
-        inputValue = directFormIITransposed(channel, inputValue);
+        blockStateSpace.reset();
+        return;
     }
 
-    return inputValue;
+    if (blockStateSpace == nullptr)
+        blockStateSpace = std::make_unique<BlockStateSpace<SampleType>>();
+
+    blockStateSpace->setThreadPool(threadPool);
 }
 
 template <typename SampleType>
-SampleType Transformations<SampleType>::directFormI(int channel, SampleType inputValue)
+SampleType Transformations<SampleType>::processSample(int channel, SampleType inputValue)
 {
-    auto& Xn1 = Xn_1[(size_t)channel];
-    auto& Xn2 = Xn_2[(size_t)channel];
-    auto& Yn1 = Yn_1[(size_t)channel];
-    auto& Yn2 = Yn_2[(size_t)channel];
+    jassert(juce::isPositiveAndBelow(channel, state.getNumChannels()));
 
-    SampleType Xn = inputValue;
+    const SampleType c[5] = { b0, b1, b2, a1, a2 };
 
-    SampleType Yn = ((Xn * b0) + (Xn1 * b1) + (Xn2 * b2) + (Yn1 * a1) + (Yn2 * a2));
-
-    Xn2 = Xn1, Yn2 = Yn1;
-    Xn1 = Xn, Yn1 = Yn;
+    return withBiquadKernel<SampleType>(transformType, [&] (auto kernel)
+    {
+        return decltype(kernel)::processSample(state, static_cast<size_t>(channel), inputValue, c);
+    });
+}
 
-    return Yn;
+template <typename SampleType>
+SampleType Transformations<SampleType>::directFormI(int channel, SampleType inputValue)
+{
+    const SampleType c[5] = { b0, b1, b2, a1, a2 };
+    return BiquadKernel<SampleType, TransformationType::directFormI>::processSample(state, static_cast<size_t>(channel), inputValue, c);
 }
 
 template <typename SampleType>
 SampleType Transformations<SampleType>::directFormII(int channel, SampleType inputValue)
 {
-    auto& Wn1 = Wn_1[(size_t)channel];
-    auto& Wn2 = Wn_2[(size_t)channel];
-
-    SampleType Xn = inputValue;
-
-    SampleType Wn = (Xn + ((Wn1 * a1) + (Wn2 * a2)));
-    SampleType Yn = ((Wn * b0) + (Wn1 * b1) + (Wn2 * b2));
-
-    Wn2 = Wn1;
-    Wn1 = Wn;
-
-    return Yn;
+    const SampleType c[5] = { b0, b1, b2, a1, a2 };
+    return BiquadKernel<SampleType, TransformationType::directFormII>::processSample(state, static_cast<size_t>(channel), inputValue, c);
 }
 
 template <typename SampleType>
 SampleType Transformations<SampleType>::directFormITransposed(int channel, SampleType inputValue)
 {
-    auto& Wn1 = Wn_1[(size_t)channel];
-    auto& Wn2 = Wn_2[(size_t)channel];
-    auto& Xn1 = Xn_1[(size_t)channel];
-    auto& Xn2 = Xn_2[(size_t)channel];
-
-    SampleType Xn = inputValue;
-
-    SampleType Wn = (Xn + Wn2);
-    SampleType Yn = ((Wn * b0) + Xn2);
-
-    Xn2 = ((Wn * b1) + Xn1), Wn2 = ((Wn * a1) + Wn1);
-    Xn1 = (Wn * b2), Wn1 = (Wn * a2);
-
-    return Yn;
+    const SampleType c[5] = { b0, b1, b2, a1, a2 };
+    return BiquadKernel<SampleType, TransformationType::directFormItransposed>::processSample(state, static_cast<size_t>(channel), inputValue, c);
 }
 
 template <typename SampleType>
 SampleType Transformations<SampleType>::directFormIITransposed(int channel, SampleType inputValue)
 {
-    auto& Xn1 = Xn_1[(size_t)channel];
-    auto& Xn2 = Xn_2[(size_t)channel];
-
-    SampleType Xn = inputValue;
-
-    SampleType Yn = ((Xn * b0) + (Xn2));
-
-    Xn2 = ((Xn * b1) + (Xn1)+(Yn * a1));
-    Xn1 = ((Xn * b2) + (Yn * a2));
-
-    return Yn;
+    const SampleType c[5] = { b0, b1, b2, a1, a2 };
+    return BiquadKernel<SampleType, TransformationType::directFormIItransposed>::processSample(state, static_cast<size_t>(channel), inputValue, c);
 }
 
 template <typename SampleType>
 void Transformations<SampleType>::snapToZero() noexcept
 {
-    for (auto v : { &Wn_1, &Wn_2, &Xn_1, &Xn_2, &Yn_1, &Yn_2 })
-        for (auto& element : *v)
-            juce::dsp::util::snapToZero(element);
+    state.snapToZero();
 }
 
 //==============================================================================
@@ -15,14 +15,10 @@
 
 #include "../JuceLibraryCode/JuceHeader.h"
 #include "OrfanidisCalc.h"
-
-enum class TransformationType
-{
-    directFormI,
-    directFormII,
-    directFormItransposed,
-    directFormIItransposed
-};
+#include "BiquadState.h"
+#include "BiquadKernel.h"
+#include "LookaheadKernel.h"
+#include "BlockStateSpace.h"
 
 template <typename SampleType>
 class Transformations
@@ -50,6 +46,21 @@ public:
 
     void setTransformType(TransformationType newTransformType);
 
+    /** Runs the channels that do not fill SIMD lanes through LookaheadKernel
+        when the transform is DFIIt. Off by default; see LookaheadKernel. */
+    void setUsingLookahead(bool shouldUseLookahead) noexcept { usingLookahead = shouldUseLookahead; }
+
+    /** Returns true if the lookahead kernel is used where it applies. */
+    bool isUsingLookahead() const noexcept { return usingLookahead; }
+
+    /** Renders DFIIt blocks through BlockStateSpace, which spreads long
+        blocks over the given pool's threads. For offline rendering only, as
+        it allocates; takes precedence over the lookahead kernel. */
+    void setNonRealtime(bool isNonRealtime, juce::ThreadPool* threadPool = nullptr);
+
+    /** Returns true if rendering through BlockStateSpace. */
+    bool isNonRealtime() const noexcept { return blockStateSpace != nullptr; }
+
     //==============================================================================
     /** Processes the input and output samples supplied in the processing context. */
     template <typename ProcessContext>
@@ -57,11 +68,9 @@ public:
     {
         const auto& inputBlock = context.getInputBlock();
         auto& outputBlock = context.getOutputBlock();
-        const auto numChannels = outputBlock.getNumChannels();
-        const auto numSamples = outputBlock.getNumSamples();
 
-        jassert(inputBlock.getNumChannels() == numChannels);
-        jassert(inputBlock.getNumSamples() == numSamples);
+        jassert(inputBlock.getNumChannels() == outputBlock.getNumChannels());
+        jassert(inputBlock.getNumSamples() == outputBlock.getNumSamples());
 
         if (context.isBypassed)
         {
@@ -69,13 +78,24 @@ public:
             return;
         }
 
-        for (size_t channel = 0; channel < numChannels; ++channel)
-        {
-            auto* inputSamples = inputBlock.getChannelPointer(channel);
-            auto* outputSamples = outputBlock.getChannelPointer(channel);
+        const SampleType c[5] = { b0, b1, b2, a1, a2 };
 
-            for (size_t i = 0; i < numSamples; ++i)
-                outputSamples[i] = processSample((int)channel, inputSamples[i]);
+        if (blockStateSpace != nullptr && transformType == transformationType::directFormIItransposed)
+        {
+            blockStateSpace->setCoefficients(c);
+            blockStateSpace->process(state, inputBlock, outputBlock);
+        }
+        else if (usingLookahead && transformType == transformationType::directFormIItransposed)
+        {
+            lookahead.setCoefficients(c);
+            lookahead.process(state, inputBlock, outputBlock, true);
+        }
+        else
+        {
+            withBiquadKernel<SampleType>(transformType, [&] (auto kernel)
+            {
+                decltype(kernel)::process(state, inputBlock, outputBlock, c, true);
+            });
         }
 
 #if JUCE_DSP_ENABLE_SNAP_TO_ZERO
@@ -96,13 +116,15 @@ public:
     SampleType directFormIITransposed(int channel, SampleType inputValue);
 
 private:
-
     //==============================================================================
-    std::vector<SampleType> Wn_1, Wn_2, Xn_1, Xn_2, Yn_1, Yn_2;
+    BiquadState<SampleType> state;
+    LookaheadKernel<SampleType> lookahead;
+    std::unique_ptr<BlockStateSpace<SampleType>> blockStateSpace;
 
     //==============================================================================
     SampleType b0 = 1.0, b1 = 0.0, b2 = 0.0, a0 = 1.0, a1 = 0.0, a2 = 0.0;
     transformationType transformType = transformationType::directFormIItransposed;
+    bool usingLookahead = false;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Transformations)
 };
@@ -62,15 +62,26 @@ void Parameters::setParameterLayout(Params& params)
         .withLabel(decibels)
         .withCategory(outParam);
 
-    params.add
-        //======================================================================
-        (std::make_unique<juce::AudioProcessorParameterGroup>("BandOneID", "0", "seperatorA",
+    for (int band = 0; band < numBands; ++band)
+    {
+        // The first band keeps the single-band group and names; the rest
+        // start spread evenly over the frequency range, in octaves.
+        const auto bandNumber = juce::String(band + 1);
+        const auto groupID = band == 0 ? juce::String("BandOneID") : ("Band" + bandNumber + "ID");
+        const auto groupName = band == 0 ? juce::String("0") : ("Band " + bandNumber);
+        const auto suffix = band == 0 ? juce::String() : (" " + bandNumber);
+        const auto defaultFrequency = numBands == 1 ? 632.455f : 20.0f * std::pow(1000.0f, (static_cast<float>(band) + 0.5f) / static_cast<float>(numBands));
+
+        params.add
             //==================================================================
-            std::make_unique<juce::AudioParameterFloat>("frequencyID", "Frequency", freqRange, 632.455f, freqAttributes),
-            std::make_unique<juce::AudioParameterFloat>("bandwidthID", "Bandwidth", resRange, 01.00f, resoAttributes),
-            std::make_unique<juce::AudioParameterFloat>("gainID", "Gain", gainRange, 00.00f, gainAttributes)
-            //==================================================================
-            ));
+            (std::make_unique<juce::AudioProcessorParameterGroup>(groupID, groupName, "seperatorA",
+                //==============================================================
+                std::make_unique<juce::AudioParameterFloat>(getBandParameterID("frequency", band), "Frequency" + suffix, freqRange, defaultFrequency, freqAttributes),
+                std::make_unique<juce::AudioParameterFloat>(getBandParameterID("bandwidth", band), "Bandwidth" + suffix, resRange, 01.00f, resoAttributes),
+                std::make_unique<juce::AudioParameterFloat>(getBandParameterID("gain", band), "Gain" + suffix, gainRange, 00.00f, gainAttributes)
+                //==============================================================
+                ));
+    }
 
     params.add
         //======================================================================
@@ -81,4 +92,11 @@ void Parameters::setParameterLayout(Params& params)
             std::make_unique<juce::AudioParameterFloat>("mixID", "Mix", mixRange, 100.00f, mixAttributes)
             //==================================================================
             ));
+}
+
+juce::String Parameters::getBandParameterID(const juce::String& name, int band)
+{
+    jassert(0 <= band && band < numBands);
+
+    return band == 0 ? (name + "ID") : (name + juce::String(band + 1) + "ID");
 }
\ No newline at end of file
@@ -15,6 +15,11 @@
 
 #include "../JuceLibraryCode/JuceHeader.h"
 
+/** The number of peak bands in series, fixed when building, e.g. 4, 8 or 16. */
+#ifndef ORFANIDISBIQUAD_NUM_BANDS
+ #define ORFANIDISBIQUAD_NUM_BANDS 1
+#endif
+
 class OrfanidisBiquadAudioProcessor;
 
 class Parameters
@@ -26,10 +31,21 @@ public:
     /** Constructor. */
     Parameters(OrfanidisBiquadAudioProcessor& p);
 
+    //==========================================================================
+    /** The number of peak bands, each with its own parameter group. */
+    static constexpr int numBands = ORFANIDISBIQUAD_NUM_BANDS;
+
+    static_assert (numBands > 0, "The plugin needs at least one band");
+
     //==========================================================================
     /** Create Parameter Layout. */
     static void setParameterLayout(Params& params);
 
+    /** Returns the ID of a band's parameter, counting bands from zero: the
+        first band keeps the single-band IDs, e.g. "frequencyID", and the
+        others are numbered, e.g. "frequency2ID". */
+    static juce::String getBandParameterID(const juce::String& name, int band);
+
 private:
     //==========================================================================
     // This reference is provided as a quick way for the wrapper to
@@ -19,10 +19,7 @@ OrfanidisBiquadAudioProcessor::OrfanidisBiquadAudioProcessor()
     spec(),
     rmsLeft(), rmsRight(),
     parameters(*this),
-    processorFloat(*this),
-    processorDouble(*this),
-    bypassState(static_cast<juce::AudioParameterBool*>(apvts.getParameter("bypassID"))),
-    processingPrecision(ProcessingPrecision::singlePrecision)
+    bypassState(static_cast<juce::AudioParameterBool*>(apvts.getParameter("bypassID")))
 {
     jassert(bypassState != nullptr);
 }
@@ -54,32 +51,7 @@ void OrfanidisBiquadAudioProcessor::setBypassParameter(juce::AudioParameterBool*
 
 bool OrfanidisBiquadAudioProcessor::supportsDoublePrecisionProcessing() const
 {
-    return false;
-}
-
-juce::AudioProcessor::ProcessingPrecision OrfanidisBiquadAudioProcessor::getProcessingPrecision() const noexcept
-{
-    return processingPrecision;
-}
-
-bool OrfanidisBiquadAudioProcessor::isUsingDoublePrecision() const noexcept
-{
-    return processingPrecision == doublePrecision;
-}
-
-void OrfanidisBiquadAudioProcessor::setProcessingPrecision(ProcessingPrecision newPrecision) noexcept
-{
-    // If you hit this assertion then you're trying to use double precision
-    // processing on a processor which does not support it!
-    jassert(newPrecision != doublePrecision || supportsDoublePrecisionProcessing());
-
-    if (processingPrecision != newPrecision)
-    {
-        processingPrecision = newPrecision;
-        releaseResources();
-        processorFloat.reset();
-        processorDouble.reset();
-    }
+    return true;
 }
 
 //==============================================================================
@@ -105,7 +77,7 @@ bool OrfanidisBiquadAudioProcessor::isMidiEffect() const
 
 double OrfanidisBiquadAudioProcessor::getTailLengthSeconds() const
 {
-    return 0.0;
+    return tailLengthSeconds.load();
 }
 
 int OrfanidisBiquadAudioProcessor::getNumPrograms()
@@ -140,8 +112,6 @@ void OrfanidisBiquadAudioProcessor::prepareToPlay (double sampleRate, int sample
 {
     juce::ignoreUnused(sampleRate, samplesPerBlock);
 
-    processingPrecision = getProcessingPrecision();
-
     spec.sampleRate = getSampleRate();
     spec.maximumBlockSize = getBlockSize();
     spec.numChannels = getTotalNumInputChannels();
@@ -152,14 +122,36 @@ void OrfanidisBiquadAudioProcessor::prepareToPlay (double sampleRate, int sample
     rmsLeft.setCurrentAndTargetValue(-100.0f);
     rmsRight.setCurrentAndTargetValue(-100.0f);
 
-    processorFloat.prepare(getSpec());
-    processorDouble.prepare(getSpec());
+    // Build the wrapper for the host's precision and drop the other, with
+    // its mixer, gain and filter state.
+    if (isUsingDoublePrecision())
+    {
+        processorFloat.reset();
+
+        if (processorDouble == nullptr)
+            processorDouble = std::make_unique<ProcessWrapper<double>>(*this);
+
+        processorDouble->prepare(getSpec());
+    }
+
+    else
+    {
+        processorDouble.reset();
+
+        if (processorFloat == nullptr)
+            processorFloat = std::make_unique<ProcessWrapper<float>>(*this);
+
+        processorFloat->prepare(getSpec());
+    }
 }
 
 void OrfanidisBiquadAudioProcessor::releaseResources()
 {
-    processorFloat.reset();
-    processorDouble.reset();
+    if (processorFloat != nullptr)
+        processorFloat->reset();
+
+    if (processorDouble != nullptr)
+        processorDouble->reset();
 }
 
 bool OrfanidisBiquadAudioProcessor::isBusesLayoutSupported (const BusesLayout& layouts) const
@@ -183,9 +175,16 @@ void OrfanidisBiquadAudioProcessor::processBlock (juce::AudioBuffer<float>& buff
 
     else
     {
+        // Flush denormals to zero for the block; see Denormals.h.
         juce::ScopedNoDenormals noDenormals;
 
-        processorFloat.process(buffer, midiMessages);
+        // The host prepares before processing in a precision; see prepareToPlay().
+        jassert(processorFloat != nullptr);
+
+        if (processorFloat == nullptr)
+            return;
+
+        processorFloat->process(buffer, midiMessages);
 
         rmsLeft.skip(buffer.getNumSamples());
         rmsRight.skip(buffer.getNumSamples());
@@ -217,9 +216,16 @@ void OrfanidisBiquadAudioProcessor::processBlock(juce::AudioBuffer<double>& buff
 
     else
     {
+        // Flush denormals to zero for the block; see Denormals.h.
         juce::ScopedNoDenormals noDenormals;
 
-        processorDouble.process(buffer, midiMessages);
+        // The host prepares before processing in a precision; see prepareToPlay().
+        jassert(processorDouble != nullptr);
+
+        if (processorDouble == nullptr)
+            return;
+
+        processorDouble->process(buffer, midiMessages);
 
         rmsLeft.skip(buffer.getNumSamples());
         rmsRight.skip(buffer.getNumSamples());
@@ -31,9 +31,6 @@ public:
 
     //==========================================================================
     bool supportsDoublePrecisionProcessing() const override;
-    ProcessingPrecision getProcessingPrecision() const noexcept;
-    bool isUsingDoublePrecision() const noexcept;
-    void setProcessingPrecision(ProcessingPrecision newPrecision) noexcept;
 
     //==============================================================================
     void prepareToPlay(double sampleRate, int samplesPerBlock) override;
@@ -86,6 +83,13 @@ public:
     juce::dsp::ProcessSpec spec;
     juce::dsp::ProcessSpec& getSpec() { return spec; };
 
+    //==========================================================================
+    /** Tail length in seconds, written by whichever wrapper is live. Owned
+        here so that the host can read it while prepareToPlay() swaps the
+        wrappers. */
+    std::atomic<double> tailLengthSeconds { 0.0 };
+    std::atomic<double>& getTailLength() { return tailLengthSeconds; };
+
     float getRMSLevel(const int channel) const;
 
 private:
@@ -94,8 +98,12 @@ private:
     //==========================================================================
     /** Audio processor members. */
     Parameters parameters;
-    ProcessWrapper<float> processorFloat;
-    ProcessWrapper<double> processorDouble;
+
+    /** Only the wrapper for the host's precision exists, built or swapped in
+        prepareToPlay(); the host sets the precision before preparing, so the
+        audio thread never allocates one. */
+    std::unique_ptr<ProcessWrapper<float>> processorFloat;
+    std::unique_ptr<ProcessWrapper<double>> processorDouble;
 
     //==========================================================================
     /** Parameter pointers. */
@@ -105,7 +113,6 @@ private:
     //==========================================================================
     /** Init variables. */
     double rampDurationSeconds = 0.05;
-    ProcessingPrecision processingPrecision;
 
     //==========================================================================
 
@@ -17,31 +17,65 @@ ProcessWrapper<SampleType>::ProcessWrapper(OrfanidisBiquadAudioProcessor& p)
     audioProcessor(p),
     state(p.getAPVTS()),
     setup(p.getSpec()),
-    frequencyPtr(dynamic_cast <juce::AudioParameterFloat*> (p.getAPVTS().getParameter("frequencyID"))),
-    resonancePtr(dynamic_cast <juce::AudioParameterFloat*> (p.getAPVTS().getParameter("bandwidthID"))),
-    gainPtr(dynamic_cast <juce::AudioParameterFloat*> (p.getAPVTS().getParameter("gainID"))),
+    tailLengthSeconds(p.getTailLength()),
     transformPtr(dynamic_cast <juce::AudioParameterChoice*> (p.getAPVTS().getParameter("transformID"))),
     outputPtr(dynamic_cast <juce::AudioParameterFloat*> (p.getAPVTS().getParameter("outputID"))),
     mixPtr(dynamic_cast <juce::AudioParameterFloat*> (p.getAPVTS().getParameter("mixID")))
 {
-    jassert(frequencyPtr != nullptr);
-    jassert(resonancePtr != nullptr);
-    jassert(gainPtr != nullptr);
+    for (size_t band = 0; band < numBands; ++band)
+    {
+        const auto index = static_cast<int>(band);
+
+        frequencyPtr[band] = dynamic_cast <juce::AudioParameterFloat*> (p.getAPVTS().getParameter(Parameters::getBandParameterID("frequency", index)));
+        resonancePtr[band] = dynamic_cast <juce::AudioParameterFloat*> (p.getAPVTS().getParameter(Parameters::getBandParameterID("bandwidth", index)));
+        gainPtr[band] = dynamic_cast <juce::AudioParameterFloat*> (p.getAPVTS().getParameter(Parameters::getBandParameterID("gain", index)));
+
+        jassert(frequencyPtr[band] != nullptr);
+        jassert(resonancePtr[band] != nullptr);
+        jassert(gainPtr[band] != nullptr);
+    }
+
     jassert(transformPtr != nullptr);
     jassert(outputPtr != nullptr);
     jassert(mixPtr != nullptr);
 
+   #if ORFANIDISBIQUAD_BACKGROUND_DESIGN
+    if constexpr (numBands == 1)
+    {
+        filter.setDesignThread(&designThread.get());
+
+        for (auto* parameterID : { "frequencyID", "bandwidthID", "gainID" })
+            state.addParameterListener(parameterID, this);
+    }
+   #endif
+}
+
+template <typename SampleType>
+ProcessWrapper<SampleType>::~ProcessWrapper()
+{
+   #if ORFANIDISBIQUAD_BACKGROUND_DESIGN
+    if constexpr (numBands == 1)
+        for (auto* parameterID : { "frequencyID", "bandwidthID", "gainID" })
+            state.removeParameterListener(parameterID, this);
+   #endif
 }
 
 template <typename SampleType>
 void ProcessWrapper<SampleType>::prepare(juce::dsp::ProcessSpec& spec)
 {
     mixer.prepare(spec);
+    filter.setRampDurationSeconds(rampDurationSeconds);
+
+    // Hand the filter the session's values first, so that prepare() snaps
+    // to them instead of ramping there from the filter's defaults.
+    setFilterParameters();
+
     filter.prepare(spec);
     output.prepare(spec);
 
     reset();
     update();
+    updateTailLength();
 };
 
 template <typename SampleType>
@@ -50,6 +84,9 @@ void ProcessWrapper<SampleType>::reset()
     mixer.reset();
     filter.reset();
     output.reset();
+
+    silentSamples = 0.0;
+    sleeping = false;
 };
 
 template <typename SampleType>
@@ -59,15 +96,42 @@ void ProcessWrapper<SampleType>::process(juce::AudioBuffer<SampleType>& buffer,
 
     update();
 
+    // Asleep on silence once the filter has rung out; see tailDecay.
+    if (! isSilent(buffer))
+    {
+        silentSamples = 0.0;
+        sleeping = false;
+    }
+    else if (silentSamples >= tailLengthSamples && ! filter.isSmoothing() && ! output.isSmoothing())
+    {
+        if (! sleeping)
+        {
+            mixer.reset();
+            filter.reset();
+            sleeping = true;
+        }
+
+        return;
+    }
+    else
+    {
+        silentSamples += buffer.getNumSamples();
+    }
+
     juce::dsp::AudioBlock<SampleType> block(buffer);
 
     mixer.pushDrySamples(block);
 
+    if (denormalInjection)
+        DenormalGuard<SampleType>::inject(block);
+
     juce::dsp::ProcessContextReplacing<SampleType> context(block);
 
     filter.process(context);
     output.process(context);
     mixer.mixWetSamples(block);
+
+    updateTailLength();
 };
 
 template <typename SampleType>
@@ -75,14 +139,57 @@ void ProcessWrapper<SampleType>::update()
 {
     mixer.setWetMixProportion(mixPtr->get() * 0.01f);
     
-    filter.setFrequency(frequencyPtr->get());
-    filter.setResonance(resonancePtr->get());
-    filter.setGain(gainPtr->get());
+    if (! backgroundDesign || numBands > 1)
+        setFilterParameters();
 
     filter.setTransformType(static_cast<TransformationType>(transformPtr->getIndex()));
     output.setGainDecibels(outputPtr->get());
 };
 
+template <typename SampleType>
+void ProcessWrapper<SampleType>::parameterChanged(const juce::String&, float)
+{
+    setFilterParameters();
+}
+
+template <typename SampleType>
+void ProcessWrapper<SampleType>::updateTailLength()
+{
+    double samples = 0.0;
+
+    if constexpr (numBands == 1)
+        samples = filter.getCoefficients().getTailLengthSamples(tailDecay);
+    else
+        for (size_t band = 0; band < numBands; ++band)
+            samples += filter.getCoefficients(band).getTailLengthSamples(tailDecay);
+
+    tailLengthSamples = samples;
+    tailLengthSeconds.store(samples / setup.sampleRate);
+}
+
+template <typename SampleType>
+bool ProcessWrapper<SampleType>::isSilent(const juce::AudioBuffer<SampleType>& buffer) noexcept
+{
+    if (buffer.hasBeenCleared())
+        return true;
+
+    for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
+        if (buffer.getMagnitude(channel, 0, buffer.getNumSamples()) != SampleType(0.0))
+            return false;
+
+    return true;
+}
+
+template <typename SampleType>
+void ProcessWrapper<SampleType>::setFilterParameters()
+{
+    if constexpr (numBands == 1)
+        filter.setParameters(frequencyPtr[0]->get(), resonancePtr[0]->get(), gainPtr[0]->get());
+    else
+        for (size_t band = 0; band < numBands; ++band)
+            filter.setParameters(band, frequencyPtr[band]->get(), resonancePtr[band]->get(), gainPtr[band]->get());
+}
+
 //==============================================================================
 template class ProcessWrapper<float>;
 template class ProcessWrapper<double>;
\ No newline at end of file
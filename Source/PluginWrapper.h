@@ -15,11 +15,26 @@
 
 #include "../JuceLibraryCode/JuceHeader.h"
 #include "Modules/OrfanidisPeak.h"
+#include "Modules/OrfanidisCascade.h"
+#include "Modules/Denormals.h"
+#include "PluginParameters.h"
+
+/** Set to 1 to design a single band on the design thread shared by every
+    instance, instead of on the audio thread; see ProcessWrapper. */
+#ifndef ORFANIDISBIQUAD_BACKGROUND_DESIGN
+ #define ORFANIDISBIQUAD_BACKGROUND_DESIGN 0
+#endif
+
+/** Set to 1 to add DenormalGuard's offset to the filter's input, for
+    targets where ScopedNoDenormals cannot flush denormals; see Denormals.h. */
+#ifndef ORFANIDISBIQUAD_DENORMAL_INJECTION
+ #define ORFANIDISBIQUAD_DENORMAL_INJECTION 0
+#endif
 
 class OrfanidisBiquadAudioProcessor;
 
 template <typename SampleType>
-class ProcessWrapper
+class ProcessWrapper : private juce::AudioProcessorValueTreeState::Listener
 {
 public:
     //using APVTS = juce::AudioProcessorValueTreeState;
@@ -28,6 +43,9 @@ public:
     /** Constructor. */
     ProcessWrapper(OrfanidisBiquadAudioProcessor& p);
 
+    /** Destructor. */
+    ~ProcessWrapper() override;
+
     //==========================================================================
     /** Initialises the processor. */
     void prepare(juce::dsp::ProcessSpec& spec);
@@ -43,28 +61,81 @@ public:
     void update();
 
 private:
+    //==========================================================================
+    /** With backgroundDesign, passes filter parameter changes straight on to
+        the design thread, from whichever thread the host changes them on. */
+    void parameterChanged(const juce::String& parameterID, float newValue) override;
+
+    /** Passes the band parameters on to the filter. */
+    void setFilterParameters();
+
+    /** Recomputes the tail from the filter's current coefficients, and
+        hands it to the processor. With several bands the tails are summed,
+        which errs on the long side. */
+    void updateTailLength();
+
+    /** Returns true if every sample of the buffer is zero. */
+    static bool isSilent(const juce::AudioBuffer<SampleType>& buffer) noexcept;
+
+    //==========================================================================
+    /** The number of peak bands in series. One runs a lone OrfanidisPeak;
+        more run every band in one OrfanidisCascade, over one pass of the
+        buffer and behind one mixer and output stage. The cascade measured
+        faster from two bands up in either type, bar two float bands in
+        stereo, which break even; see OrfanidisCascade. */
+    static constexpr size_t numBands = static_cast<size_t>(Parameters::numBands);
+
     //==========================================================================
     // This reference is provided as a quick way for the wrapper to
     // access the processor object that created it.
     OrfanidisBiquadAudioProcessor& audioProcessor;
     juce::AudioProcessorValueTreeState& state;
     juce::dsp::ProcessSpec& setup;
+    std::atomic<double>& tailLengthSeconds;
 
     //==============================================================================
     /** Instantiate objects. */
+   #if ORFANIDISBIQUAD_BACKGROUND_DESIGN
+    juce::SharedResourcePointer<DesignThread> designThread;
+   #endif
     juce::dsp::DryWetMixer<SampleType> mixer;
-    OrfanidisPeak<SampleType> filter;
+    std::conditional_t<numBands == 1, OrfanidisPeak<SampleType>, OrfanidisCascade<SampleType, numBands>> filter;
     juce::dsp::Gain<SampleType> output;
 
     //==========================================================================
     /** Parameter pointers. */
-    juce::AudioParameterFloat* frequencyPtr { nullptr };
-    juce::AudioParameterFloat* resonancePtr { nullptr };
-    juce::AudioParameterFloat* gainPtr { nullptr };
+    juce::AudioParameterFloat* frequencyPtr[numBands] {};
+    juce::AudioParameterFloat* resonancePtr[numBands] {};
+    juce::AudioParameterFloat* gainPtr[numBands] {};
     juce::AudioParameterChoice* transformPtr { nullptr };
     juce::AudioParameterFloat* outputPtr { nullptr };
     juce::AudioParameterFloat* mixPtr { nullptr };
 
+    //==========================================================================
+    /** Init variables. */
+    double rampDurationSeconds = 0.05;
+
+    /** Silence. Once the input has been all zeros for as long as the tail,
+        whatever is left ringing is below tailDecay of the last input, so the
+        filter is cleared and process() returns at once, leaving the zeros,
+        until a block that is not silent arrives. Not while parameters are
+        still ramping, so that no ramp is cut short. The tail is finite even
+        for a filter that never decays; see CoefficientSet. */
+    static constexpr double tailDecay = 1.0e-5;
+    double tailLengthSamples = 0.0, silentSamples = 0.0;
+    bool sleeping = false;
+
+    /** Adds DenormalGuard's offset to the filter's input, for builds where
+        processBlock()'s ScopedNoDenormals cannot flush denormals to zero.
+        Set with ORFANIDISBIQUAD_DENORMAL_INJECTION; see Denormals.h. */
+    static constexpr bool denormalInjection = ORFANIDISBIQUAD_DENORMAL_INJECTION != 0;
+
+    /** Designs on the design thread shared by every instance in the process,
+        instead of in update() on the audio thread. Set with
+        ORFANIDISBIQUAD_BACKGROUND_DESIGN; see OrfanidisPeak. A cascade
+        always designs on the audio thread. */
+    static constexpr bool backgroundDesign = ORFANIDISBIQUAD_BACKGROUND_DESIGN != 0;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ProcessWrapper)
 };
 
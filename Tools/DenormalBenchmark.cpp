@@ -0,0 +1,143 @@
+/*
+  ==============================================================================
+
+    DenormalBenchmark.cpp
+    Created: 17 Oct 2026 12:40:00pm
+    Author:  StoneyDSP
+
+    Denormal stress test for the strategies in Source/Modules/Denormals.h.
+    It is not part of the plugin: build it as a console program against the
+    JUCE modules, together with the .cpp files in Source/Modules, and run
+
+        DenormalBenchmark
+
+    Each run feeds an OrfanidisPeak one block of noise and then silence, so
+    that its tail decays into the denormal range, and times every block.
+    For each strategy it prints the median block and the 99th percentile;
+    without a strategy the tail settles among the denormals rather than at
+    zero, and the median itself slows down.
+
+    Build it with JUCE_DSP_ENABLE_SNAP_TO_ZERO=0, as the plugin is built, or
+    every strategy snaps.
+
+  ==============================================================================
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "../Source/Modules/OrfanidisPeak.h"
+#include "../Source/Modules/Denormals.h"
+
+#if JUCE_DSP_ENABLE_SNAP_TO_ZERO
+ #error "Build with JUCE_DSP_ENABLE_SNAP_TO_ZERO=0, or every strategy snaps"
+#endif
+
+namespace
+{
+    //==============================================================================
+    enum class Strategy
+    {
+        none,
+        flushToZero,
+        injection,
+        snapping
+    };
+
+    const char* const strategyNames[] = { "none", "flush to zero", "injection", "snapping" };
+    const char* const transformNames[] = { "DFI", "DFII", "DFI t", "DFII t" };
+
+    constexpr double sampleRate = 48000.0;
+    constexpr size_t numChannels = 2, blockSize = 256, numBlocks = 4096;
+
+    //==============================================================================
+    /** Times every block of one run, in nanoseconds. */
+    template <typename SampleType>
+    std::vector<double> run(TransformationType transformType, Strategy strategy)
+    {
+        OrfanidisPeak<SampleType> filter;
+        juce::dsp::ProcessSpec spec { sampleRate, static_cast<juce::uint32>(blockSize), static_cast<juce::uint32>(numChannels) };
+
+        filter.setTransformType(transformType);
+        filter.setParameters(SampleType(1000.0), SampleType(0.25), SampleType(12.0));
+        filter.prepare(spec);
+
+        std::vector<SampleType> samples(numChannels * blockSize);
+        SampleType* channels[numChannels];
+
+        for (size_t channel = 0; channel < numChannels; ++channel)
+            channels[channel] = samples.data() + (channel * blockSize);
+
+        std::mt19937 random(1);
+        std::uniform_real_distribution<double> noise(-1.0, 1.0);
+
+        std::vector<double> times;
+        times.reserve(numBlocks);
+
+        for (size_t b = 0; b < numBlocks; ++b)
+        {
+            for (auto& sample : samples)
+                sample = b == 0 ? static_cast<SampleType>(noise(random)) : SampleType(0.0);
+
+            juce::dsp::AudioBlock<SampleType> block(channels, numChannels, blockSize);
+            juce::dsp::ProcessContextReplacing<SampleType> context(block);
+
+            const auto start = std::chrono::steady_clock::now();
+
+            if (strategy == Strategy::flushToZero)
+            {
+                juce::ScopedNoDenormals noDenormals;
+                filter.process(context);
+            }
+            else
+            {
+                if (strategy == Strategy::injection)
+                    DenormalGuard<SampleType>::inject(block);
+
+                filter.process(context);
+
+                if (strategy == Strategy::snapping)
+                    filter.snapToZero();
+            }
+
+            times.push_back(std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count());
+        }
+
+        return times;
+    }
+
+    //==============================================================================
+    template <typename SampleType>
+    void report(const char* precision)
+    {
+        for (int transform = 0; transform < 4; ++transform)
+        {
+            for (int strategy = 0; strategy < 4; ++strategy)
+            {
+                auto times = run<SampleType>(static_cast<TransformationType>(transform), static_cast<Strategy>(strategy));
+
+                std::sort(times.begin(), times.end());
+                const auto median = times[times.size() / 2];
+                const auto percentile = times[(times.size() * 99) / 100];
+
+                std::printf("%-6s  %-6s  %-13s  median %8.0f ns  99th %9.0f ns\n", precision, transformNames[transform],
+                            strategyNames[strategy], median, percentile);
+            }
+        }
+    }
+}
+
+//==============================================================================
+int main()
+{
+    // Start from the hardware default, with denormals supported, whatever
+    // the runtime chose.
+    juce::FloatVectorOperations::disableDenormalisedNumberSupport(false);
+
+    report<float>("float");
+    report<double>("double");
+
+    return 0;
+}
@@ -0,0 +1,218 @@
+/*
+  ==============================================================================
+
+    OrfanidisSurrogateFit.cpp
+    Created: 17 Oct 2026 6:30:00am
+    Author:  StoneyDSP
+
+    Offline generator for Source/Modules/OrfanidisSurrogateData.h. It is not
+    part of the plugin: build it as a console program against the JUCE
+    modules, together with Source/Modules/OrfanidisDesign.cpp, and run
+
+        OrfanidisSurrogateFit > Source/Modules/OrfanidisSurrogateData.h
+
+  ==============================================================================
+*/
+
+#include <cmath>
+#include <cstdio>
+#include "../Source/Modules/OrfanidisDesign.h"
+
+namespace
+{
+    //==============================================================================
+    constexpr int degree = 3;
+    constexpr int numNodes = degree + 1;
+    constexpr int numTerms = numNodes * numNodes * numNodes;
+    constexpr int numOutputs = 4;
+
+    const long double pi = 3.14159265358979323846264338L;
+
+    const double frequencyEdges[] = { 0.0, 1.0, 1.5, 0.65 * 3.14159265358979323846 };
+    const double bandwidthEdges[] = { 0.0625, 0.25, 1.0 };
+    const double gainEdges[] = { -24.0823996531, 0.0, 24.0823996531 };
+
+    constexpr int numFrequencyPatches = 3, numBandwidthPatches = 2, numGainPatches = 2;
+
+    //==============================================================================
+    /** The fitted quantities at one point, normalised as OrfanidisSurrogate
+        expects: W2 / w0^2, A / (w0 bw), B / (w0 bw) and G1 - 1. */
+    void getOutputs(long double w0, long double bw, long double gain, long double (&outputs)[numOutputs])
+    {
+        // With omega = 1 the frequency argument is w0 itself.
+        const auto set = OrfanidisDesign<double>::calculate(static_cast<double>(w0), static_cast<double>(bw), static_cast<double>(gain), 1.0);
+
+        // Invert the bilinear assembly in OrfanidisSurrogate::calculate():
+        //     a1 + 1 - a2 = 4 / D0,  1 - a2 = 2 (1 + W2) / D0,  1 + a2 = 2 A / D0
+        //     b0 + b2 = 2 (G1 + W2) / D0,  b0 - b2 = 2 B / D0
+        const long double a1 = set.a1, a2 = set.a2, b0 = set.b0, b2 = set.b2;
+        const auto D0 = 4.0L / (a1 + 1.0L - a2);
+
+        const auto W2 = (1.0L - a2) * D0 / 2.0L - 1.0L;
+        const auto A = (1.0L + a2) * D0 / 2.0L;
+        const auto B = (b0 - b2) * D0 / 2.0L;
+        const auto G1 = (b0 + b2) * D0 / 2.0L - W2;
+
+        outputs[0] = W2 / (w0 * w0);
+        outputs[1] = A / (w0 * bw);
+        outputs[2] = B / (w0 * bw);
+        outputs[3] = G1 - 1.0L;
+    }
+
+    /** Power-basis coefficients of T0..T3, by Chebyshev index then power. */
+    const long double chebyshevToPower[numNodes][numNodes] =
+    {
+        { 1.0L,  0.0L, 0.0L, 0.0L },
+        { 0.0L,  1.0L, 0.0L, 0.0L },
+        { -1.0L, 0.0L, 2.0L, 0.0L },
+        { 0.0L, -3.0L, 0.0L, 4.0L }
+    };
+
+    /** Interpolates one patch at the tensor Chebyshev nodes, and returns the
+        interpolant in the power basis of the local coordinates, indexed
+        [output][(i * numNodes + j) * numNodes + k] for t_w0^i t_bw^j t_gain^k. */
+    void fitPatch(const double (&lo)[3], const double (&hi)[3], long double (&power)[numOutputs][numTerms])
+    {
+        const auto node = [] (int n) { return std::cos(pi * (n + 0.5L) / numNodes); };
+        const auto toParameter = [&] (int axis, long double t) { return lo[axis] + (t + 1.0L) * (hi[axis] - lo[axis]) / 2.0L; };
+
+        long double values[numOutputs][numTerms];
+
+        for (int i = 0; i < numNodes; ++i)
+            for (int j = 0; j < numNodes; ++j)
+                for (int k = 0; k < numNodes; ++k)
+                {
+                    long double outputs[numOutputs];
+                    getOutputs(toParameter(0, node(i)), toParameter(1, node(j)), toParameter(2, node(k)), outputs);
+
+                    for (int o = 0; o < numOutputs; ++o)
+                        values[o][(i * numNodes + j) * numNodes + k] = outputs[o];
+                }
+
+        for (int o = 0; o < numOutputs; ++o)
+        {
+            long double chebyshev[numTerms] = {};
+
+            // Discrete Chebyshev transform along all three axes.
+            for (int a = 0; a < numNodes; ++a)
+                for (int b = 0; b < numNodes; ++b)
+                    for (int c = 0; c < numNodes; ++c)
+                    {
+                        long double sum = 0.0L;
+
+                        for (int i = 0; i < numNodes; ++i)
+                            for (int j = 0; j < numNodes; ++j)
+                                for (int k = 0; k < numNodes; ++k)
+                                    sum += values[o][(i * numNodes + j) * numNodes + k]
+                                         * std::cos(pi * a * (i + 0.5L) / numNodes)
+                                         * std::cos(pi * b * (j + 0.5L) / numNodes)
+                                         * std::cos(pi * c * (k + 0.5L) / numNodes);
+
+                        const auto scale = [] (int n) { return (n == 0 ? 1.0L : 2.0L) / numNodes; };
+                        chebyshev[(a * numNodes + b) * numNodes + c] = sum * scale(a) * scale(b) * scale(c);
+                    }
+
+            for (int i = 0; i < numNodes; ++i)
+                for (int j = 0; j < numNodes; ++j)
+                    for (int k = 0; k < numNodes; ++k)
+                    {
+                        long double sum = 0.0L;
+
+                        for (int a = 0; a < numNodes; ++a)
+                            for (int b = 0; b < numNodes; ++b)
+                                for (int c = 0; c < numNodes; ++c)
+                                    sum += chebyshev[(a * numNodes + b) * numNodes + c]
+                                         * chebyshevToPower[a][i] * chebyshevToPower[b][j] * chebyshevToPower[c][k];
+
+                        power[o][(i * numNodes + j) * numNodes + k] = sum;
+                    }
+        }
+    }
+
+    void printEdges(const char* name, const double* edges, int numEdges)
+    {
+        std::printf("    constexpr double %s[] = { ", name);
+
+        for (int n = 0; n < numEdges; ++n)
+            std::printf("%.17g%s", edges[n], n + 1 < numEdges ? ", " : " };\n");
+    }
+}
+
+//==============================================================================
+int main()
+{
+    std::printf("/*\n"
+                "  ==============================================================================\n"
+                "\n"
+                "    OrfanidisSurrogateData.h\n"
+                "    Generated by Tools/OrfanidisSurrogateFit.cpp - do not edit.\n"
+                "\n"
+                "  ==============================================================================\n"
+                "*/\n"
+                "\n"
+                "#pragma once\n"
+                "\n"
+                "#ifndef ORFANIDISSURROGATEDATA_H_INCLUDED\n"
+                "#define ORFANIDISSURROGATEDATA_H_INCLUDED\n"
+                "\n"
+                "namespace OrfanidisSurrogateData\n"
+                "{\n");
+
+    std::printf("    constexpr int degree = %d;\n", degree);
+    std::printf("    constexpr int numFrequencyPatches = %d, numBandwidthPatches = %d, numGainPatches = %d;\n\n",
+                numFrequencyPatches, numBandwidthPatches, numGainPatches);
+
+    printEdges("frequencyEdges", frequencyEdges, numFrequencyPatches + 1);
+    printEdges("bandwidthEdges", bandwidthEdges, numBandwidthPatches + 1);
+    printEdges("gainEdges", gainEdges, numGainPatches + 1);
+
+    std::printf("\n    /** [frequency][bandwidth][gain patch][output][(i * %d + j) * %d + k], the\n"
+                "        coefficient of t_w0^i t_bw^j t_gain^k. */\n", numNodes, numNodes);
+    std::printf("    constexpr double coefficients[%d][%d][%d][%d][%d] =\n    {\n",
+                numFrequencyPatches, numBandwidthPatches, numGainPatches, numOutputs, numTerms);
+
+    for (int f = 0; f < numFrequencyPatches; ++f)
+    {
+        std::printf("        {\n");
+
+        for (int b = 0; b < numBandwidthPatches; ++b)
+        {
+            std::printf("            {\n");
+
+            for (int g = 0; g < numGainPatches; ++g)
+            {
+                const double lo[3] = { frequencyEdges[f], bandwidthEdges[b], gainEdges[g] };
+                const double hi[3] = { frequencyEdges[f + 1], bandwidthEdges[b + 1], gainEdges[g + 1] };
+
+                long double power[numOutputs][numTerms];
+                fitPatch(lo, hi, power);
+
+                std::printf("                {\n");
+
+                for (int o = 0; o < numOutputs; ++o)
+                {
+                    std::printf("                    {");
+
+                    for (int t = 0; t < numTerms; ++t)
+                        std::printf("%s%.17g%s", t % 4 == 0 ? "\n                        " : " ",
+                                    static_cast<double>(power[o][t]), t + 1 < numTerms ? "," : "");
+
+                    std::printf("\n                    }%s\n", o + 1 < numOutputs ? "," : "");
+                }
+
+                std::printf("                }%s\n", g + 1 < numGainPatches ? "," : "");
+            }
+
+            std::printf("            }%s\n", b + 1 < numBandwidthPatches ? "," : "");
+        }
+
+        std::printf("        }%s\n", f + 1 < numFrequencyPatches ? "," : "");
+    }
+
+    std::printf("    };\n"
+                "}\n"
+                "\n"
+                "#endif //ORFANIDISSURROGATEDATA_H_INCLUDED\n");
+
+    return 0;
+}